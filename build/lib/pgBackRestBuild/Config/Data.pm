@@ -186,6 +186,7 @@ use constant CFGOPT_DB_TIMEOUT                                      => 'db-timeo
 use constant CFGOPT_COMPRESS                                        => 'compress';
 use constant CFGOPT_COMPRESS_TYPE                                   => 'compress-type';
 use constant CFGOPT_COMPRESS_LEVEL                                  => 'compress-level';
+use constant CFGOPT_COMPRESS_LEVEL_ADAPTIVE                         => 'compress-level-adaptive';
 use constant CFGOPT_COMPRESS_LEVEL_NETWORK                          => 'compress-level-network';
 use constant CFGOPT_IO_TIMEOUT                                      => 'io-timeout';
 use constant CFGOPT_JOB_RETRY                                       => 'job-retry';
@@ -291,7 +292,9 @@ use constant CFGOPT_REPO_S3_VERIFY_TLS                              => CFGDEF_RE
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPT_ARCHIVE_ASYNC                                   => 'archive-async';
 use constant CFGOPT_ARCHIVE_GET_QUEUE_MAX                           => 'archive-get-queue-max';
+use constant CFGOPT_ARCHIVE_PUSH_AHEAD                              => 'archive-push-ahead';
 use constant CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                          => 'archive-push-queue-max';
+use constant CFGOPT_ARCHIVE_PUSH_TRIM                               => 'archive-push-trim';
 
 # Backup options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -299,6 +302,7 @@ use constant CFGOPT_ARCHIVE_CHECK                                   => 'archive-
 use constant CFGOPT_ARCHIVE_COPY                                    => 'archive-copy';
 use constant CFGOPT_ARCHIVE_MODE_CHECK                              => 'archive-mode-check';
 use constant CFGOPT_BACKUP_STANDBY                                  => 'backup-standby';
+use constant CFGOPT_CHECKSUM_BLOCK                                  => 'checksum-block';
 use constant CFGOPT_CHECKSUM_PAGE                                   => 'checksum-page';
 use constant CFGOPT_EXCLUDE                                         => 'exclude';
 use constant CFGOPT_EXPIRE_AUTO                                     => 'expire-auto';
@@ -311,8 +315,10 @@ use constant CFGOPT_STOP_AUTO                                       => 'stop-aut
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPT_ARCHIVE_MODE                                    => 'archive-mode';
 use constant CFGOPT_DB_INCLUDE                                      => 'db-include';
+use constant CFGOPT_DECODE_HOST                                     => 'decode-host';
 use constant CFGOPT_LINK_ALL                                        => 'link-all';
 use constant CFGOPT_LINK_MAP                                        => 'link-map';
+use constant CFGOPT_SYNC_DEFER                                      => 'sync-defer';
 use constant CFGOPT_TABLESPACE_MAP_ALL                              => 'tablespace-map-all';
 use constant CFGOPT_TABLESPACE_MAP                                  => 'tablespace-map';
 use constant CFGOPT_RECOVERY_OPTION                                 => 'recovery-option';
@@ -373,6 +379,7 @@ use constant CFGOPTVAL_REPO_TYPE_S3                                 => 's3';
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPTVAL_REPO_CIPHER_TYPE_NONE                        => 'none';
 use constant CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                 => 'aes-256-cbc';
+use constant CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM                 => 'aes-256-gcm';
 
 # Repo S3 URI style
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -596,6 +603,10 @@ my $rhCommandDefine =
     {
         &CFGDEF_LOCK_REQUIRED => true,
         &CFGDEF_LOCK_TYPE => CFGDEF_LOCK_TYPE_BACKUP,
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_LOCAL => {},
+        },
     },
 
     &CFGCMD_HELP =>
@@ -1151,6 +1162,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_PUSH => {},
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
+            &CFGCMD_EXPIRE => {},
             &CFGCMD_INFO => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
@@ -1186,6 +1198,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_PUSH => {},
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
+            &CFGCMD_EXPIRE => {},
             &CFGCMD_INFO => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
@@ -1504,6 +1517,21 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_COMPRESS_LEVEL_ADAPTIVE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_COMPRESS_LEVEL_NETWORK =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1619,6 +1647,7 @@ my %hConfigDefine =
                 &CFGDEF_DEFAULT => 1,
             },
             &CFGCMD_BACKUP => {},
+            &CFGCMD_EXPIRE => {},
             &CFGCMD_RESTORE => {},
             &CFGCMD_VERIFY => {},
         },
@@ -1678,6 +1707,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_PUSH => {},
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
+            &CFGCMD_EXPIRE => {},
             &CFGCMD_INFO => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
@@ -1845,7 +1875,7 @@ my %hConfigDefine =
         &CFGDEF_DEPEND =>
         {
             &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_CIPHER_TYPE,
-            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC],
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC, CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM],
         },
         &CFGDEF_NAME_ALT =>
         {
@@ -1864,6 +1894,7 @@ my %hConfigDefine =
         [
             &CFGOPTVAL_REPO_CIPHER_TYPE_NONE,
             &CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC,
+            &CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM,
         ],
         &CFGDEF_NAME_ALT =>
         {
@@ -2527,6 +2558,7 @@ my %hConfigDefine =
                 &CFGDEF_COMMAND_ROLE =>
                 {
                     &CFGCMD_ROLE_DEFAULT => {},
+                    &CFGCMD_ROLE_LOCAL => {},
                 },
             },
             &CFGCMD_INFO =>
@@ -2670,6 +2702,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_GET => {},
             &CFGCMD_ARCHIVE_PUSH => {},
             &CFGCMD_BACKUP => {},
+            &CFGCMD_EXPIRE => {},
             &CFGCMD_RESTORE => {},
             &CFGCMD_VERIFY => {},
         },
@@ -2726,6 +2759,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_PUSH => {},
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
+            &CFGCMD_EXPIRE => {},
             &CFGCMD_INFO => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
@@ -2762,6 +2796,21 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_ARCHIVE_PUSH_AHEAD =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_ARCHIVE_PUSH_QUEUE_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2783,6 +2832,22 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_ARCHIVE_PUSH_TRIM =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+            &CFGCMD_ROLE_ASYNC => {},
+        },
+    },
+
     &CFGOPT_ARCHIVE_GET_QUEUE_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2886,6 +2951,21 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_CHECKSUM_BLOCK =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_CHECKSUM_PAGE =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -3029,6 +3109,26 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_DECODE_HOST =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => 'pg',
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_RESTORE => {},
+        },
+        &CFGDEF_ALLOW_LIST =>
+        [
+            'pg',
+            'repo',
+        ],
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_LINK_ALL =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -3059,6 +3159,21 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_SYNC_DEFER =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_RESTORE => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_TABLESPACE_MAP_ALL =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
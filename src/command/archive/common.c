@@ -398,6 +398,27 @@ walIsSegment(const String *walSegment)
     FUNCTION_LOG_RETURN(BOOL, regExpMatch(regExpSegment, walSegment));
 }
 
+/**********************************************************************************************************************************/
+bool
+walIsTrimmed(const String *archiveFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STRING, archiveFile);
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveFile != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        result = strEndsWithZ(compressExtStrip(archiveFile, compressTypeFromName(archiveFile)), WAL_SEGMENT_TRIM_EXT);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /**********************************************************************************************************************************/
 String *
 walSegmentFind(const Storage *storage, const String *archiveId, const String *walSegment, TimeMSec timeout)
@@ -426,7 +447,7 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
             StringList *list = storageListP(
                 storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(strSubN(walSegment, 0, 16))),
                 .expression = strNewFmt(
-                    "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(walSegment, 0, 24)),
+                    "^%s%s-[0-f]{40}" WAL_SEGMENT_TRIM_REGEXP COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(walSegment, 0, 24)),
                         walIsPartial(walSegment) ? WAL_SEGMENT_PARTIAL_EXT : ""),
                 .nullOnMissing = true);
 
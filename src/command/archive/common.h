@@ -47,13 +47,19 @@ WAL segment constants
 #define WAL_SEGMENT_PARTIAL_REGEXP                                  WAL_SEGMENT_PREFIX_REGEXP "(\\.partial){0,1}$"
     STRING_DECLARE(WAL_SEGMENT_PARTIAL_REGEXP_STR);
 
+// Extension for WAL segments stored without their zero tail by archive-push. It is placed before the compression extension so
+// releases that do not restore the tail do not match these segments and report them missing rather than returning them short.
+#define WAL_SEGMENT_TRIM_EXT                                        ".trim"
+#define WAL_SEGMENT_TRIM_REGEXP                                     "(\\.trim){0,1}"
+
 // Defines the size of standard WAL segment name -- hopefully this won't change
 #define WAL_SEGMENT_NAME_SIZE                                       ((unsigned int)24)
 
 // WAL segment directory/file
 #define WAL_SEGMENT_DIR_REGEXP                                      "^[0-F]{16}$"
     STRING_DECLARE(WAL_SEGMENT_DIR_REGEXP_STR);
-#define WAL_SEGMENT_FILE_REGEXP                                     "^[0-F]{24}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$"
+#define WAL_SEGMENT_FILE_REGEXP                                                                                                    \
+    "^[0-F]{24}-[0-f]{40}" WAL_SEGMENT_TRIM_REGEXP COMPRESS_TYPE_REGEXP "{0,1}$"
     STRING_DECLARE(WAL_SEGMENT_FILE_REGEXP_STR);
 
 // Timeline history file
@@ -88,6 +94,9 @@ bool walIsPartial(const String *walSegment);
 // Is the file a segment or some other file (e.g. .history, .backup, etc)
 bool walIsSegment(const String *walSegment);
 
+// Was the zero tail of the WAL segment trimmed by archive-push? The archive file name is checked for the trim extension.
+bool walIsTrimmed(const String *archiveFile);
+
 // Generates the location of the wal directory using a relative wal path and the supplied pg path
 String *walPath(const String *walFile, const String *pgPath, const String *command);
 
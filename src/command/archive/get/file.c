@@ -5,6 +5,7 @@ Archive Get File
 
 #include "command/archive/get/file.h"
 #include "command/archive/common.h"
+#include "command/archive/walTail.h"
 #include "command/control/common.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
@@ -71,6 +72,10 @@ ArchiveGetFileResult archiveGetFile(
                     compressible = false;
                 }
 
+                // Restore the zero tail if it was trimmed by archive-push
+                if (walIsSegment(request) && walIsTrimmed(actual->file))
+                    ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), walTailPadNew());
+
                 // Copy the file
                 storageCopyP(
                     storageNewReadP(
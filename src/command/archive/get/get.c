@@ -155,8 +155,9 @@ archiveGetFind(
                                 storageRepoIdx(cacheRepo->repoIdx),
                                 strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(cacheArchive->archiveId), strZ(path)),
                                 .expression = strNewFmt(
-                                    "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(archiveFileRequest, 0, 24)),
-                                        walIsPartial(archiveFileRequest) ? WAL_SEGMENT_PARTIAL_EXT : ""));
+                                    "^%s%s-[0-f]{40}" WAL_SEGMENT_TRIM_REGEXP COMPRESS_TYPE_REGEXP "{0,1}$",
+                                    strZ(strSubN(archiveFileRequest, 0, 24)),
+                                    walIsPartial(archiveFileRequest) ? WAL_SEGMENT_PARTIAL_EXT : ""));
                         }
                         // Else multiple files will be requested so cache list results
                         else
@@ -180,7 +181,8 @@ archiveGetFind(
                                                 storageRepoIdx(cacheRepo->repoIdx),
                                                 strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(cacheArchive->archiveId), strZ(path)),
                                                 .expression = strNewFmt(
-                                                    "^%s[0-F]{8}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(path))),
+                                                    "^%s[0-F]{8}-[0-f]{40}" WAL_SEGMENT_TRIM_REGEXP COMPRESS_TYPE_REGEXP "{0,1}$",
+                                                    strZ(path))),
                                         });
                                 }
                                 MEM_CONTEXT_END();
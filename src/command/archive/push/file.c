@@ -5,6 +5,7 @@ Archive Push File
 
 #include "command/archive/push/file.h"
 #include "command/archive/common.h"
+#include "command/archive/walTail.h"
 #include "command/control/common.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
@@ -82,7 +83,7 @@ archivePushFileIo(ArchivePushFileIoType type, IoWrite *write, const Buffer *buff
 ArchivePushFileResult
 archivePushFile(
     const String *walSource, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile, CompressType compressType,
-    int compressLevel, const ArchivePushFileRepoData *repoData)
+    int compressLevel, bool trim, const ArchivePushFileRepoData *repoData)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, walSource);
@@ -91,6 +92,7 @@ archivePushFile(
         FUNCTION_LOG_PARAM(STRING, archiveFile);
         FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(INT, compressLevel);
+        FUNCTION_LOG_PARAM(BOOL, trim);
         FUNCTION_LOG_PARAM_P(VOID, repoData);
     FUNCTION_LOG_END();
 
@@ -110,9 +112,11 @@ archivePushFile(
         bool isSegment = walIsSegment(archiveFile);
 
         // If this is a segment compare archive version and systemId to the WAL header
+        PgWal walInfo = {0};
+
         if (isSegment)
         {
-            PgWal walInfo = pgWalFromFile(walSource, storageLocal());
+            walInfo = pgWalFromFile(walSource, storageLocal());
 
             if (walInfo.version != pgVersion || walInfo.systemId != pgSystemId)
             {
@@ -131,6 +135,9 @@ archivePushFile(
         bool destinationCopyAny = true;
         bool *destinationCopy = memNew(sizeof(bool) * repoTotal);
 
+        // Limit on the bytes to copy from the source when the zero tail is trimmed
+        const Variant *sourceLimit = NULL;
+
         for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
             destinationCopy[repoIdx] = true;
 
@@ -140,13 +147,31 @@ archivePushFile(
             // Assume that no repos need a copy of the WAL segment and update when a repo needing a copy is found
             destinationCopyAny = false;
 
-            // Generate a sha1 checksum for the wal segment
+            // Generate a sha1 checksum for the wal segment. The checksum is always for the full segment so it matches the segment
+            // restored by archive-get.
             IoRead *read = storageReadIo(storageNewReadP(storageLocal(), walSource));
             ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+            // Find the size of the segment without the zero tail
+            if (trim)
+                ioFilterGroupAdd(ioReadFilterGroup(read), walTailSizeNew());
+
             ioReadDrain(read);
 
             const String *walSegmentChecksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
 
+            if (trim)
+            {
+                uint64_t sizeData = varUInt64(ioFilterGroupResult(ioReadFilterGroup(read), WAL_TAIL_SIZE_FILTER_TYPE_STR));
+
+                // Always keep the WAL header since the segment size it contains is required to pad the segment when it is read
+                if (sizeData < PG_WAL_HEADER_SIZE)
+                    sizeData = PG_WAL_HEADER_SIZE;
+
+                if (sizeData < walInfo.size)
+                    sourceLimit = VARUINT64(sizeData);
+            }
+
             // Check each repo for the WAL segment
             for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
             {
@@ -157,20 +182,24 @@ archivePushFile(
                 {
                     String *walSegmentRepoChecksum = strSubN(walSegmentFile, strSize(archiveFile) + 1, HASH_TYPE_SHA1_SIZE_HEX);
 
-                    // If the checksums are the same then succeed but warn in case this is a symptom of some other issue
+                    // If the checksums are the same then succeed but warn in case this is a symptom of some other issue. There is
+                    // nothing to warn about when the WAL segment was pushed ahead to this repo since it is expected to exist.
                     if (strEq(walSegmentChecksum, walSegmentRepoChecksum))
                     {
-                        MEM_CONTEXT_PRIOR_BEGIN()
+                        if (!repoData[repoIdx].pushedAhead)
                         {
-                            // Add warning to the result that will be returned to the main process
-                            strLstAdd(
-                                result.warnList,
-                                strNewFmt(
-                                    "WAL file '%s' already exists in the repo%u archive with the same checksum"
-                                    "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
-                                    strZ(archiveFile), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx)));
+                            MEM_CONTEXT_PRIOR_BEGIN()
+                            {
+                                // Add warning to the result that will be returned to the main process
+                                strLstAdd(
+                                    result.warnList,
+                                    strNewFmt(
+                                        "WAL file '%s' already exists in the repo%u archive with the same checksum"
+                                        "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
+                                        strZ(archiveFile), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx)));
+                            }
+                            MEM_CONTEXT_PRIOR_END();
                         }
-                        MEM_CONTEXT_PRIOR_END();
 
                         // No need to copy to this repo
                         destinationCopy[repoIdx] = false;
@@ -190,13 +219,17 @@ archivePushFile(
 
             // Append the checksum to the archive destination
             strCatFmt(archiveDestination, "-%s", strZ(walSegmentChecksum));
+
+            // Mark the segment as trimmed so readers know to restore the zero tail
+            if (sourceLimit != NULL)
+                strCatZ(archiveDestination, WAL_SEGMENT_TRIM_EXT);
         }
 
         // Copy the file if one or more repos require it
         if (destinationCopyAny)
         {
             // Source file is read once and copied to all repos
-            StorageRead *source = storageNewReadP(storageLocal(), walSource);
+            StorageRead *source = storageNewReadP(storageLocal(), walSource, .limit = sourceLimit);
 
             // Is the file compressible during the copy?
             bool compressible = true;
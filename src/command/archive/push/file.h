@@ -18,6 +18,7 @@ typedef struct ArchivePushFileRepoData
     const String *archiveId;
     CipherType cipherType;
     const String *cipherPass;
+    bool pushedAhead;                                               // Was the WAL segment pushed ahead to this repo already?
 } ArchivePushFileRepoData;
 
 /***********************************************************************************************************************************
@@ -28,9 +29,9 @@ typedef struct ArchivePushFileResult
     StringList *warnList;                                           // Warnings from a successful operation
 } ArchivePushFileResult;
 
-// Copy a file from the source to the archive
+// Copy a file from the source to the archive. When trim is set the zero tail of WAL segments is not stored.
 ArchivePushFileResult archivePushFile(
     const String *walSource, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile, CompressType compressType,
-    int compressLevel, const ArchivePushFileRepoData *repoData);
+    int compressLevel, bool trim, const ArchivePushFileRepoData *repoData);
 
 #endif
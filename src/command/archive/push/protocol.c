@@ -36,7 +36,7 @@ archivePushProtocol(const String *command, const VariantList *paramList, Protoco
     {
         if (strEq(command, PROTOCOL_COMMAND_ARCHIVE_PUSH_STR))
         {
-            const unsigned int paramFixed = 6;                      // Fixed params before the repo param array
+            const unsigned int paramFixed = 7;                      // Fixed params before the repo param array
             const unsigned int paramRepo = 3;                       // Parameters in each index of the repo array
 
             // Check that the correct number of repo parameters were passed
@@ -51,13 +51,14 @@ archivePushProtocol(const String *command, const VariantList *paramList, Protoco
                 repoData[repoIdx].cipherType = (CipherType)varUIntForce(
                     varLstGet(paramList, paramFixed + (repoIdx * paramRepo) + 1));
                 repoData[repoIdx].cipherPass = varStr(varLstGet(paramList, paramFixed + (repoIdx * paramRepo) + 2));
+                repoData[repoIdx].pushedAhead = false;
             }
 
             // Push the file
             ArchivePushFileResult fileResult = archivePushFile(
                 varStr(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varUInt64(varLstGet(paramList, 2)),
                 varStr(varLstGet(paramList, 3)), (CompressType)varUIntForce(varLstGet(paramList, 4)),
-                varIntForce(varLstGet(paramList, 5)), repoData);
+                varIntForce(varLstGet(paramList, 5)), varBool(varLstGet(paramList, 6)), repoData);
 
             // Return result
             VariantList *result = varLstNew();
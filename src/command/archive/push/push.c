@@ -220,7 +220,8 @@ archivePushCheck(bool pgPathSet)
             // Get the repo storage in case it is remote and encryption settings need to be pulled down
             storageRepoIdx(repoIdx);
 
-            // Set cipher type in repo data
+            // Set cipher type in repo data. The WAL segment is not known to be pushed ahead until the repo is checked for it.
+            result.repoData[repoIdx].pushedAhead = false;
             result.repoData[repoIdx].cipherType = cipherType(cfgOptionIdxStr(cfgOptRepoCipherType, repoIdx));
 
             // Attempt to load the archive info file
@@ -264,6 +265,200 @@ archivePushCheck(bool pgPathSet)
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
 
+/***********************************************************************************************************************************
+Job data and callback for pushing WAL files in parallel. Used by the async process and by push ahead in sync mode.
+***********************************************************************************************************************************/
+typedef struct ArchivePushAsyncData
+{
+    const String *walPath;                                          // Path to pg_wal/pg_xlog
+    const StringList *walFileList;                                  // List of wal files to process
+    unsigned int walFileIdx;                                        // Current index in the list to be processed
+    CompressType compressType;                                      // Type of compression for WAL segments
+    int compressLevel;                                              // Compression level for wal files
+    bool trim;                                                      // Trim the zero tail of WAL segments?
+    ArchivePushCheckResult archiveInfo;                             // Archive info
+} ArchivePushAsyncData;
+
+static ProtocolParallelJob *
+archivePushAsyncCallback(void *data, unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    // No special logic based on the client, we'll just get the next job
+    (void)clientIdx;
+
+    // Get a new job if there are any left
+    ArchivePushAsyncData *jobData = data;
+
+    if (jobData->walFileIdx < strLstSize(jobData->walFileList))
+    {
+        const String *walFile = strLstGet(jobData->walFileList, jobData->walFileIdx);
+        jobData->walFileIdx++;
+
+        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR);
+        protocolCommandParamAdd(command, VARSTR(strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile))));
+        protocolCommandParamAdd(command, VARUINT(jobData->archiveInfo.pgVersion));
+        protocolCommandParamAdd(command, VARUINT64(jobData->archiveInfo.pgSystemId));
+        protocolCommandParamAdd(command, VARSTR(walFile));
+        protocolCommandParamAdd(command, VARUINT(jobData->compressType));
+        protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+        protocolCommandParamAdd(command, VARBOOL(jobData->trim));
+
+        // Add data for each repo to push to
+        for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+        {
+            protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.repoData[repoIdx].archiveId));
+            protocolCommandParamAdd(command, VARUINT(jobData->archiveInfo.repoData[repoIdx].cipherType));
+            protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.repoData[repoIdx].cipherPass));
+        }
+
+        FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
+    }
+
+    FUNCTION_TEST_RETURN(NULL);
+}
+
+/***********************************************************************************************************************************
+Get the list of WAL segments to push ahead in sync mode. The list starts with the WAL segment requested by PostgreSQL, followed by
+ready WAL segments after it, up to the total requested.
+***********************************************************************************************************************************/
+static StringList *
+archivePushAheadList(const String *walPath, const String *archiveFile, unsigned int total)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(STRING, archiveFile);
+        FUNCTION_LOG_PARAM(UINT, total);
+    FUNCTION_LOG_END();
+
+    ASSERT(walPath != NULL);
+    ASSERT(archiveFile != NULL);
+    ASSERT(total > 0);
+
+    StringList *result = strLstNew();
+    strLstAdd(result, archiveFile);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StringList *readyList = archivePushReadyList(walPath);
+
+        for (unsigned int readyIdx = 0; readyIdx < strLstSize(readyList) && strLstSize(result) < total; readyIdx++)
+        {
+            const String *readyFile = strLstGet(readyList, readyIdx);
+
+            // Only WAL segments after the requested segment are pushed ahead. Other files, e.g. history files, are left for
+            // PostgreSQL to request in order.
+            if (walIsSegment(readyFile) && strCmp(readyFile, archiveFile) > 0)
+                strLstAdd(result, readyFile);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+Push WAL segments in parallel in sync mode. An error on the first segment (the one requested by PostgreSQL) is thrown after all
+segments have been processed. Errors on the other segments are logged as warnings since PostgreSQL will request them later.
+***********************************************************************************************************************************/
+static void
+archivePushAhead(const String *walPath, const StringList *walFileList, ArchivePushCheckResult archiveInfo)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(STRING_LIST, walFileList);
+    FUNCTION_LOG_END();
+
+    ASSERT(walPath != NULL);
+    ASSERT(walFileList != NULL);
+    ASSERT(strLstSize(walFileList) > 1);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *archiveFile = strLstGet(walFileList, 0);
+        int errorCodeFile = 0;
+        const String *errorMessageFile = NULL;
+
+        ArchivePushAsyncData jobData =
+        {
+            .walPath = walPath,
+            .walFileList = walFileList,
+            .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
+            .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .trim = cfgOptionBool(cfgOptArchivePushTrim),
+            .archiveInfo = archiveInfo,
+        };
+
+        // Create the parallel executor
+        ProtocolParallel *parallelExec = protocolParallelNew(
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archivePushAsyncCallback, &jobData);
+
+        for (unsigned int processIdx = 1; processIdx <= strLstSize(walFileList); processIdx++)
+            protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
+
+        // Process jobs
+        do
+        {
+            unsigned int completed = protocolParallelProcess(parallelExec);
+
+            for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+            {
+                // Get the job and job key
+                ProtocolParallelJob *job = protocolParallelResult(parallelExec);
+                unsigned int processId = protocolParallelJobProcessId(job);
+                const String *walFile = varStr(protocolParallelJobKey(job));
+                bool requested = strEq(walFile, archiveFile);
+
+                // The job was successful
+                if (protocolParallelJobErrorCode(job) == 0)
+                {
+                    // Output file warnings
+                    StringList *fileWarnList = strLstNewVarLst(
+                        varVarLst(varLstGet(varVarLst(protocolParallelJobResult(job)), 0)));
+
+                    for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileWarnList); warnIdx++)
+                        LOG_WARN_PID(processId, strZ(strLstGet(fileWarnList, warnIdx)));
+
+                    // Log success
+                    if (requested)
+                        LOG_INFO_FMT("pushed WAL file '%s' to the archive", strZ(walFile));
+                    else
+                        LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive ahead", strZ(walFile));
+                }
+                // Else the job errored
+                else if (requested)
+                {
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        errorCodeFile = protocolParallelJobErrorCode(job);
+                        errorMessageFile = strDup(protocolParallelJobErrorMessage(job));
+                    }
+                    MEM_CONTEXT_PRIOR_END();
+                }
+                else
+                {
+                    LOG_WARN_PID_FMT(
+                        processId, "could not push WAL file '%s' to the archive ahead (will be retried): [%d] %s", strZ(walFile),
+                        protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
+                }
+
+                protocolParallelJobFree(job);
+            }
+        }
+        while (!protocolParallelDone(parallelExec));
+
+        // Throw the error for the requested WAL segment
+        if (errorCodeFile != 0)
+            THROWP(errorTypeFromCode(errorCodeFile), strZ(errorMessageFile));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 cmdArchivePush(void)
@@ -376,17 +571,57 @@ cmdArchivePush(void)
                 // Check archive info for each repo
                 ArchivePushCheckResult archiveInfo = archivePushCheck(cfgOptionTest(cfgOptPgPath));
 
-                // Push the file to the archive
-                ArchivePushFileResult fileResult = archivePushFile(
-                    walFile, archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
-                    compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel), archiveInfo.repoData);
+                // If push ahead is enabled then check each repo for the WAL segment, which is there when a prior command pushed it
+                // ahead to that repo. If no repo has it then push ready WAL segments after it in parallel, but only when there are
+                // enough to keep all processes busy. A smaller queue is pushed in this process so local processes are not started
+                // unless archiving is falling behind.
+                bool pushedAhead = false;
+                StringList *walFileList = NULL;
+
+                if (cfgOptionBool(cfgOptArchivePushAhead) && cfgOptionUInt(cfgOptProcessMax) > 1 && walIsSegment(archiveFile))
+                {
+                    for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+                    {
+                        archiveInfo.repoData[repoIdx].pushedAhead =
+                            walSegmentFind(storageRepoIdx(repoIdx), archiveInfo.repoData[repoIdx].archiveId, archiveFile, 0) !=
+                                NULL;
+                        pushedAhead |= archiveInfo.repoData[repoIdx].pushedAhead;
+                    }
 
-                // If a warning was returned then log it
-                for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileResult.warnList); warnIdx++)
-                    LOG_WARN(strZ(strLstGet(fileResult.warnList, warnIdx)));
+                    if (!pushedAhead)
+                        walFileList = archivePushAheadList(strPath(walFile), archiveFile, cfgOptionUInt(cfgOptProcessMax));
+                }
 
-                // Log success
-                LOG_INFO_FMT("pushed WAL file '%s' to the archive", strZ(archiveFile));
+                if (walFileList != NULL && strLstSize(walFileList) == cfgOptionUInt(cfgOptProcessMax))
+                {
+                    archivePushAhead(strPath(walFile), walFileList, archiveInfo);
+                }
+                else
+                {
+                    // Push the file to the archive
+                    ArchivePushFileResult fileResult = archivePushFile(
+                        walFile, archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
+                        compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel),
+                        cfgOptionBool(cfgOptArchivePushTrim), archiveInfo.repoData);
+
+                    // If a warning was returned then log it
+                    for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileResult.warnList); warnIdx++)
+                        LOG_WARN(strZ(strLstGet(fileResult.warnList, warnIdx)));
+
+                    // A WAL segment that was pushed ahead is expected to already exist in the repo
+                    for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+                    {
+                        if (archiveInfo.repoData[repoIdx].pushedAhead)
+                        {
+                            LOG_DETAIL_FMT(
+                                "WAL file '%s' was already pushed ahead to the repo%u archive", strZ(archiveFile),
+                                cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx));
+                        }
+                    }
+
+                    // Log success
+                    LOG_INFO_FMT("pushed WAL file '%s' to the archive", strZ(archiveFile));
+                }
             }
         }
     }
@@ -396,57 +631,6 @@ cmdArchivePush(void)
 }
 
 /**********************************************************************************************************************************/
-typedef struct ArchivePushAsyncData
-{
-    const String *walPath;                                          // Path to pg_wal/pg_xlog
-    const StringList *walFileList;                                  // List of wal files to process
-    unsigned int walFileIdx;                                        // Current index in the list to be processed
-    CompressType compressType;                                      // Type of compression for WAL segments
-    int compressLevel;                                              // Compression level for wal files
-    ArchivePushCheckResult archiveInfo;                             // Archive info
-} ArchivePushAsyncData;
-
-static ProtocolParallelJob *
-archivePushAsyncCallback(void *data, unsigned int clientIdx)
-{
-    FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM_P(VOID, data);
-        FUNCTION_TEST_PARAM(UINT, clientIdx);
-    FUNCTION_TEST_END();
-
-    // No special logic based on the client, we'll just get the next job
-    (void)clientIdx;
-
-    // Get a new job if there are any left
-    ArchivePushAsyncData *jobData = data;
-
-    if (jobData->walFileIdx < strLstSize(jobData->walFileList))
-    {
-        const String *walFile = strLstGet(jobData->walFileList, jobData->walFileIdx);
-        jobData->walFileIdx++;
-
-        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR);
-        protocolCommandParamAdd(command, VARSTR(strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile))));
-        protocolCommandParamAdd(command, VARUINT(jobData->archiveInfo.pgVersion));
-        protocolCommandParamAdd(command, VARUINT64(jobData->archiveInfo.pgSystemId));
-        protocolCommandParamAdd(command, VARSTR(walFile));
-        protocolCommandParamAdd(command, VARUINT(jobData->compressType));
-        protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
-
-        // Add data for each repo to push to
-        for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
-        {
-            protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.repoData[repoIdx].archiveId));
-            protocolCommandParamAdd(command, VARUINT(jobData->archiveInfo.repoData[repoIdx].cipherType));
-            protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.repoData[repoIdx].cipherPass));
-        }
-
-        FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
-    }
-
-    FUNCTION_TEST_RETURN(NULL);
-}
-
 void
 cmdArchivePushAsync(void)
 {
@@ -470,6 +654,7 @@ cmdArchivePushAsync(void)
             .walPath = strLstGet(commandParam, 0),
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .trim = cfgOptionBool(cfgOptArchivePushTrim),
         };
 
         TRY_BEGIN()
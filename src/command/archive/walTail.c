@@ -0,0 +1,287 @@
+/***********************************************************************************************************************************
+WAL Segment Zero Tail Filters
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include "command/archive/walTail.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+#include "postgres/interface.h"
+
+/***********************************************************************************************************************************
+Filter type constants
+***********************************************************************************************************************************/
+STRING_EXTERN(WAL_TAIL_SIZE_FILTER_TYPE_STR,                        WAL_TAIL_SIZE_FILTER_TYPE);
+STRING_EXTERN(WAL_TAIL_PAD_FILTER_TYPE_STR,                         WAL_TAIL_PAD_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object types
+***********************************************************************************************************************************/
+typedef struct WalTailSize
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    uint64_t size;                                                  // Total size of all input
+    uint64_t sizeData;                                              // Size of input up to and including the last non-zero byte
+} WalTailSize;
+
+typedef struct WalTailPad
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    Buffer *header;                                                 // WAL header collected from the input
+    uint64_t segmentSize;                                           // Segment size from the WAL header (0 until the input is done)
+    uint64_t size;                                                  // Total size of output
+    size_t inputPos;                                                // Position in input buffer
+    bool inputSame;                                                 // Is the same input required again?
+    bool done;                                                      // Is the filter done?
+} WalTailPad;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+walTailSizeToLog(const WalTailSize *this)
+{
+    return strNewFmt("{size: %" PRIu64 ", sizeData: %" PRIu64 "}", this->size, this->sizeData);
+}
+
+#define FUNCTION_LOG_WAL_TAIL_SIZE_TYPE                                                                                            \
+    WalTailSize *
+#define FUNCTION_LOG_WAL_TAIL_SIZE_FORMAT(value, buffer, bufferSize)                                                               \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, walTailSizeToLog, buffer, bufferSize)
+
+static String *
+walTailPadToLog(const WalTailPad *this)
+{
+    return strNewFmt(
+        "{segmentSize: %" PRIu64 ", size: %" PRIu64 ", inputSame: %s, done: %s}", this->segmentSize, this->size,
+        cvtBoolToConstZ(this->inputSame), cvtBoolToConstZ(this->done));
+}
+
+#define FUNCTION_LOG_WAL_TAIL_PAD_TYPE                                                                                             \
+    WalTailPad *
+#define FUNCTION_LOG_WAL_TAIL_PAD_FORMAT(value, buffer, bufferSize)                                                                \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, walTailPadToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Find the last non-zero byte in the input
+***********************************************************************************************************************************/
+static void
+walTailSizeProcess(THIS_VOID, const Buffer *input)
+{
+    THIS(WalTailSize);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(WAL_TAIL_SIZE, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+
+    const unsigned char *inputPtr = bufPtrConst(input);
+    size_t inputIdx = bufUsed(input);
+
+    while (inputIdx > 0 && inputPtr[inputIdx - 1] == 0)
+        inputIdx--;
+
+    if (inputIdx > 0)
+        this->sizeData = this->size + inputIdx;
+
+    this->size += bufUsed(input);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Return size without the zero tail
+***********************************************************************************************************************************/
+static Variant *
+walTailSizeResult(THIS_VOID)
+{
+    THIS(WalTailSize);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(WAL_TAIL_SIZE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewUInt64(this->sizeData));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+walTailSizeNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("WalTailSize")
+    {
+        WalTailSize *driver = memNew(sizeof(WalTailSize));
+
+        *driver = (WalTailSize)
+        {
+            .memContext = memContextCurrent(),
+        };
+
+        this = ioFilterNewP(WAL_TAIL_SIZE_FILTER_TYPE_STR, driver, NULL, .in = walTailSizeProcess, .result = walTailSizeResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+/***********************************************************************************************************************************
+Copy input to output and pad with zeros to the segment size when the input is done
+***********************************************************************************************************************************/
+static void
+walTailPadProcess(THIS_VOID, const Buffer *input, Buffer *output)
+{
+    THIS(WalTailPad);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(WAL_TAIL_PAD, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+        FUNCTION_LOG_PARAM(BUFFER, output);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(output != NULL);
+
+    if (input != NULL)
+    {
+        // Determine how much data needs to be copied and reduce if there is not enough space in the output
+        size_t copySize = bufUsed(input) - this->inputPos;
+
+        if (copySize > bufRemains(output))
+            copySize = bufRemains(output);
+
+        // Collect the WAL header
+        if (!bufFull(this->header))
+        {
+            size_t headerSize = bufRemains(this->header);
+
+            bufCatSub(this->header, input, this->inputPos, headerSize < copySize ? headerSize : copySize);
+        }
+
+        // Copy data to the output buffer
+        bufCatSub(output, input, this->inputPos, copySize);
+        this->size += copySize;
+
+        // If all data was copied then reset inputPos and allow new input
+        if (this->inputPos + copySize == bufUsed(input))
+        {
+            this->inputSame = false;
+            this->inputPos = 0;
+        }
+        // Else update inputPos and indicate that the same input should be passed again
+        else
+        {
+            this->inputSame = true;
+            this->inputPos += copySize;
+        }
+    }
+    // Else pad with zeros up to the segment size
+    else
+    {
+        // Get the segment size from the WAL header. The header is always kept when the zero tail is trimmed so a missing or invalid
+        // header means the segment is damaged.
+        if (this->segmentSize == 0)
+        {
+            if (!bufFull(this->header))
+            {
+                THROW_FMT(
+                    FormatError, "WAL segment size %" PRIu64 " is shorter than the WAL header size %u", this->size,
+                    PG_WAL_HEADER_SIZE);
+            }
+
+            this->segmentSize = pgWalFromBuffer(this->header).size;
+        }
+
+        if (this->segmentSize > this->size)
+        {
+            size_t padSize = bufRemains(output);
+
+            if (padSize > this->segmentSize - this->size)
+                padSize = (size_t)(this->segmentSize - this->size);
+
+            memset(bufRemainsPtr(output), 0, padSize);
+            bufUsedInc(output, padSize);
+            this->size += padSize;
+        }
+
+        this->done = this->size >= this->segmentSize;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is the filter done?
+***********************************************************************************************************************************/
+static bool
+walTailPadDone(const THIS_VOID)
+{
+    THIS(const WalTailPad);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(WAL_TAIL_PAD, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->done);
+}
+
+/***********************************************************************************************************************************
+Is the same input required again?
+***********************************************************************************************************************************/
+static bool
+walTailPadInputSame(const THIS_VOID)
+{
+    THIS(const WalTailPad);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(WAL_TAIL_PAD, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+walTailPadNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("WalTailPad")
+    {
+        WalTailPad *driver = memNew(sizeof(WalTailPad));
+
+        *driver = (WalTailPad)
+        {
+            .memContext = memContextCurrent(),
+            .header = bufNew(PG_WAL_HEADER_SIZE),
+        };
+
+        this = ioFilterNewP(
+            WAL_TAIL_PAD_FILTER_TYPE_STR, driver, NULL, .done = walTailPadDone, .inOut = walTailPadProcess,
+            .inputSame = walTailPadInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
@@ -0,0 +1,30 @@
+/***********************************************************************************************************************************
+WAL Segment Zero Tail Filters
+
+Segments that PostgreSQL switched before they were full have a zero-filled tail after the last record. The size filter finds the
+size of the segment without the zero tail so archive-push can store only that part and mark it with the trim extension. The pad
+filter restores the zero tail of marked segments using the segment size from the WAL header so readers always get a full size
+segment.
+***********************************************************************************************************************************/
+#ifndef COMMAND_ARCHIVE_WALTAIL_H
+#define COMMAND_ARCHIVE_WALTAIL_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constants
+***********************************************************************************************************************************/
+#define WAL_TAIL_SIZE_FILTER_TYPE                                   "walTailSize"
+    STRING_DECLARE(WAL_TAIL_SIZE_FILTER_TYPE_STR);
+#define WAL_TAIL_PAD_FILTER_TYPE                                    "walTailPad"
+    STRING_DECLARE(WAL_TAIL_PAD_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Result is the size of the data without the zero tail
+IoFilter *walTailSizeNew(void);
+
+IoFilter *walTailPadNew(void);
+
+#endif
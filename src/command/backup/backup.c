@@ -9,20 +9,25 @@ Backup Command
 #include <unistd.h>
 
 #include "command/archive/common.h"
+#include "command/archive/walTail.h"
 #include "command/control/common.h"
 #include "command/backup/backup.h"
 #include "command/backup/common.h"
 #include "command/backup/file.h"
 #include "command/backup/protocol.h"
 #include "command/check/common.h"
+#include "command/progress.h"
 #include "command/stanza/common.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/compress/helper.h"
 #include "common/debug.h"
 #include "common/io/filter/size.h"
 #include "common/log.h"
+#include "common/stat.h"
 #include "common/time.h"
 #include "common/type/convert.h"
+#include "common/type/json.h"
+#include "common/type/pack.h"
 #include "config/config.h"
 #include "db/helper.h"
 #include "info/infoArchive.h"
@@ -515,6 +520,181 @@ backupBuildIncr(const InfoBackup *infoBackup, Manifest *manifest, Manifest *mani
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/***********************************************************************************************************************************
+Manifest journal
+
+Saving the entire manifest copy every time the save threshold is crossed is expensive when there are millions of files, so between
+full saves only the results of files copied since the last save are written, each batch to a new journal segment. Segments are
+numbered in the order they were written and resume applies them to the manifest copy in the same order. A full save of the manifest
+copy includes everything in the journal so existing segments are removed afterwards.
+***********************************************************************************************************************************/
+#define BACKUP_MANIFEST_JOURNAL                                     BACKUP_MANIFEST_FILE ".journal"
+#define BACKUP_MANIFEST_JOURNAL_EXP                                 "^backup\\.manifest\\.journal\\.[0-9]{8}$"
+
+// Write file results to a new journal segment
+static void
+backupManifestJournalSave(
+    const Manifest *const manifest, const List *const fileJournal, const unsigned int segmentIdx, const String *cipherPassBackup)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_LOG_PARAM(LIST, fileJournal);
+        FUNCTION_LOG_PARAM(UINT, segmentIdx);
+        FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+    ASSERT(fileJournal != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Open file for write
+        IoWrite *write = storageWriteIo(
+            storageNewWriteP(
+                storageRepoWrite(),
+                strNewFmt(
+                    STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_JOURNAL ".%08u", strZ(manifestData(manifest)->backupLabel),
+                    segmentIdx)));
+
+        // Add encryption filter if required
+        cipherBlockFilterGroupAdd(
+            ioWriteFilterGroup(write), cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeEncrypt, cipherPassBackup);
+
+        ioWriteOpen(write);
+
+        // Write file results
+        PackWrite *pack = pckWriteNew(write);
+        pckWriteArrayBeginP(pack);
+
+        for (unsigned int fileIdx = 0; fileIdx < lstSize(fileJournal); fileIdx++)
+        {
+            const ManifestFile *const file = manifestFileFind(manifest, *(const String **)lstGet(fileJournal, fileIdx));
+
+            pckWriteObjBeginP(pack);
+            pckWriteStrP(pack, file->name);
+            pckWriteU64P(pack, file->size);
+            pckWriteU64P(pack, file->sizeRepo);
+            pckWriteStrP(pack, STR(file->checksumSha1));
+            pckWriteBoolP(pack, file->checksumPage);
+            pckWriteBoolP(pack, file->checksumPageError);
+            pckWriteU32P(pack, file->compressLevel);
+            pckWriteBoolP(pack, file->compressSkip);
+            pckWriteU32P(pack, file->checksumBlockSize);
+            pckWriteStrP(pack, file->checksumBlockSha1);
+
+            if (file->checksumPageErrorList != NULL)
+                pckWriteStrP(pack, jsonFromVar(varNewVarLst(file->checksumPageErrorList)));
+
+            pckWriteObjEndP(pack);
+        }
+
+        pckWriteArrayEndP(pack);
+        pckWriteEndP(pack);
+
+        ioWriteClose(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Apply all journal segments to a manifest loaded from the manifest copy
+static void
+backupManifestJournalLoad(Manifest *const manifest, const String *cipherPassBackup)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const backupPath = strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(manifestData(manifest)->backupLabel));
+        const StringList *const segmentList = strLstSort(
+            storageListP(storageRepo(), backupPath, .expression = STRDEF(BACKUP_MANIFEST_JOURNAL_EXP)), sortOrderAsc);
+
+        for (unsigned int segmentIdx = 0; segmentIdx < strLstSize(segmentList); segmentIdx++)
+        {
+            StorageRead *read = storageNewReadP(
+                storageRepo(), strNewFmt("%s/%s", strZ(backupPath), strZ(strLstGet(segmentList, segmentIdx))));
+
+            // Add decryption filter if required
+            cipherBlockFilterGroupAdd(
+                ioReadFilterGroup(storageReadIo(read)), cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeDecrypt,
+                cipherPassBackup);
+
+            ioReadOpen(storageReadIo(read));
+
+            // Apply file results. Files that are no longer in the manifest are ignored.
+            PackRead *pack = pckReadNew(storageReadIo(read));
+            pckReadArrayBeginP(pack);
+
+            while (pckReadNext(pack))
+            {
+                pckReadObjBeginP(pack, .id = pckReadId(pack));
+
+                const String *const name = pckReadStrP(pack);
+                const uint64_t size = pckReadU64P(pack);
+                const uint64_t sizeRepo = pckReadU64P(pack);
+                const String *const checksumSha1 = pckReadStrP(pack);
+                const bool checksumPage = pckReadBoolP(pack);
+                const bool checksumPageError = pckReadBoolP(pack);
+                const unsigned int compressLevel = pckReadU32P(pack);
+                const bool compressSkip = pckReadBoolP(pack);
+                const unsigned int checksumBlockSize = pckReadU32P(pack);
+                const String *const checksumBlockSha1 = pckReadStrP(pack);
+                const VariantList *checksumPageErrorList = NULL;
+
+                if (!pckReadNullP(pack))
+                    checksumPageErrorList = jsonToVarLst(pckReadStrP(pack));
+
+                pckReadObjEndP(pack);
+
+                if (manifestFileFindDefault(manifest, name, NULL) != NULL)
+                {
+                    manifestFileUpdate(
+                        manifest, name, size, sizeRepo, compressLevel, compressSkip, strZ(checksumSha1), checksumBlockSize,
+                        checksumBlockSha1, VARSTR(NULL), checksumPage, checksumPageError, checksumPageErrorList);
+                }
+            }
+
+            pckReadArrayEndP(pack);
+            pckReadEndP(pack);
+
+            ioReadClose(storageReadIo(read));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Remove all journal segments
+static void
+backupManifestJournalRemove(const Manifest *const manifest)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const backupPath = strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(manifestData(manifest)->backupLabel));
+        const StringList *const segmentList = storageListP(
+            storageRepo(), backupPath, .expression = STRDEF(BACKUP_MANIFEST_JOURNAL_EXP));
+
+        for (unsigned int segmentIdx = 0; segmentIdx < strLstSize(segmentList); segmentIdx++)
+            storageRemoveP(storageRepoWrite(), strNewFmt("%s/%s", strZ(backupPath), strZ(strLstGet(segmentList, segmentIdx))));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Check for a backup that can be resumed and merge into the manifest if found
 ***********************************************************************************************************************************/
@@ -526,6 +706,7 @@ typedef struct BackupResumeData
     const bool delta;                                               // Is this a delta backup?
     const String *backupPath;                                       // Path to the current level of the backup being cleaned
     const String *manifestParentName;                               // Parent manifest name used to construct manifest name
+    bool block;                                                     // Are block checksums being cleaned?
 } BackupResumeData;
 
 // Callback to clean invalid paths/files/links out of the resumable backup path
@@ -548,9 +729,12 @@ void backupResumeCallback(void *data, const StorageInfo *info)
         return;
     }
 
-    // Skip backup.manifest.copy -- it must be preserved to allow resume again if this process throws an error before writing the
-    // manifest for the first time
-    if (resumeData->manifestParentName == NULL && strEqZ(info->name, BACKUP_MANIFEST_FILE INFO_COPY_EXT))
+    // Skip backup.manifest.copy and journal segments -- they must be preserved to allow resume again if this process throws an
+    // error before writing the manifest for the first time. Also skip the block checksum path since it is cleaned after the files
+    // are, when it is known which files were kept.
+    if (resumeData->manifestParentName == NULL && !resumeData->block &&
+        (strEqZ(info->name, BACKUP_MANIFEST_FILE INFO_COPY_EXT) || strBeginsWithZ(info->name, BACKUP_MANIFEST_JOURNAL ".") ||
+         strEqZ(info->name, MANIFEST_PATH_BLOCK)))
     {
         FUNCTION_TEST_RETURN_VOID();
         return;
@@ -593,6 +777,22 @@ void backupResumeCallback(void *data, const StorageInfo *info)
         // -------------------------------------------------------------------------------------------------------------------------
         case storageTypeFile:
         {
+            // Keep block checksums only for files that were kept with block checksums. Block checksums are written before the file
+            // result is recorded so they are valid for any file that was resumed with block checksums.
+            if (resumeData->block)
+            {
+                const ManifestFile *file = manifestFileFindDefault(resumeData->manifest, manifestName, NULL);
+
+                if (file == NULL || file->reference != NULL || file->checksumSha1[0] == '\0' || file->checksumBlockSize == 0)
+                {
+                    LOG_DETAIL_FMT(
+                        "remove block checksums '%s' from resumed backup", strZ(storagePathP(storageRepo(), backupPath)));
+                    storageRemoveP(storageRepoWrite(), backupPath);
+                }
+
+                break;
+            }
+
             // If the file is compressed then strip off the extension before doing the lookup
             CompressType fileCompressType = compressTypeFromName(manifestName);
 
@@ -606,7 +806,8 @@ void backupResumeCallback(void *data, const StorageInfo *info)
             // Check if the file can be resumed or must be removed
             const char *removeReason = NULL;
 
-            if (fileCompressType != resumeData->compressType)
+            // Files that were found to be incompressible are stored without compression
+            if (fileCompressType != (fileResume != NULL && fileResume->compressSkip ? compressTypeNone : resumeData->compressType))
                 removeReason = "mismatched compression type";
             else if (file == NULL)
                 removeReason = "missing in manifest";
@@ -628,8 +829,10 @@ void backupResumeCallback(void *data, const StorageInfo *info)
             else
             {
                 manifestFileUpdate(
-                    resumeData->manifest, manifestName, file->size, fileResume->sizeRepo, fileResume->checksumSha1, NULL,
-                    fileResume->checksumPage, fileResume->checksumPageError, fileResume->checksumPageErrorList);
+                    resumeData->manifest, manifestName, file->size, fileResume->sizeRepo, fileResume->compressLevel,
+                    fileResume->compressSkip, fileResume->checksumSha1, fileResume->checksumBlockSize,
+                    fileResume->checksumBlockSha1, NULL, fileResume->checksumPage, fileResume->checksumPageError,
+                    fileResume->checksumPageErrorList);
             }
 
             // Remove the file if it could not be resumed
@@ -710,6 +913,7 @@ backupResumeFind(const Manifest *manifest, const String *cipherPassBackup)
                         {
                             manifestResume = manifestLoadFile(
                                 storageRepo(), manifestFile, cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherPassBackup);
+                            backupManifestJournalLoad(manifestResume, cipherPassBackup);
                             const ManifestData *manifestResumeData = manifestData(manifestResume);
 
                             // Check pgBackRest version. This allows the resume implementation to be changed with each version of
@@ -821,6 +1025,12 @@ backupResume(Manifest *manifest, const String *cipherPassBackup)
             };
 
             storageInfoListP(storageRepo(), resumeData.backupPath, backupResumeCallback, &resumeData, .sortOrder = sortOrderAsc);
+
+            // Clean block checksums now that the files that were kept are known
+            resumeData.block = true;
+            resumeData.backupPath = strNewFmt("%s/" MANIFEST_PATH_BLOCK, strZ(resumeData.backupPath));
+
+            storageInfoListP(storageRepo(), resumeData.backupPath, backupResumeCallback, &resumeData, .sortOrder = sortOrderAsc);
         }
     }
     MEM_CONTEXT_TEMP_END();
@@ -1057,14 +1267,15 @@ Log the results of a job and throw errors
 ***********************************************************************************************************************************/
 static uint64_t
 backupJobResult(
-    Manifest *manifest, const String *host, const String *const fileName, StringList *fileRemove, ProtocolParallelJob *const job,
-    const uint64_t sizeTotal, uint64_t sizeCopied)
+    Manifest *manifest, const String *host, const String *const fileName, StringList *fileRemove, List *fileJournal,
+    ProtocolParallelJob *const job, const uint64_t sizeTotal, uint64_t sizeCopied)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(STRING, fileName);
         FUNCTION_LOG_PARAM(STRING_LIST, fileRemove);
+        FUNCTION_LOG_PARAM(LIST, fileJournal);
         FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL_JOB, job);
         FUNCTION_LOG_PARAM(UINT64, sizeTotal);
         FUNCTION_LOG_PARAM(UINT64, sizeCopied);
@@ -1073,6 +1284,7 @@ backupJobResult(
     ASSERT(manifest != NULL);
     ASSERT(fileName != NULL);
     ASSERT(fileRemove != NULL);
+    ASSERT(fileJournal != NULL);
     ASSERT(job != NULL);
 
     // The job was successful
@@ -1089,6 +1301,12 @@ backupJobResult(
             const uint64_t repoSize = varUInt64(varLstGet(jobResult, 2));
             const String *const copyChecksum = varStr(varLstGet(jobResult, 3));
             const KeyValue *const checksumPageResult = varKv(varLstGet(jobResult, 4));
+            const unsigned int compressLevel = varUIntForce(varLstGet(jobResult, 5));
+            // A file already marked to skip compression, e.g. inherited from a prior backup in delta or kept from a resumed backup,
+            // was sent to the job without compression so the job did not probe it. It is still stored without compression.
+            const bool compressSkip = varBool(varLstGet(jobResult, 6)) || file->compressSkip;
+            const unsigned int checksumBlockSize = varUIntForce(varLstGet(jobResult, 7));
+            const String *const checksumBlockSha1 = varStr(varLstGet(jobResult, 8));
 
             // Increment backup copy progress
             sizeCopied += copySize;
@@ -1213,8 +1431,11 @@ backupJobResult(
 
                 // Update file info and remove any reference to the file's existence in a prior backup
                 manifestFileUpdate(
-                    manifest, file->name, copySize, repoSize, strZ(copyChecksum), VARSTR(NULL), file->checksumPage,
-                    checksumPageError, checksumPageErrorList);
+                    manifest, file->name, copySize, repoSize, compressLevel, compressSkip, strZ(copyChecksum), checksumBlockSize,
+                    checksumBlockSha1, VARSTR(NULL), file->checksumPage, checksumPageError, checksumPageErrorList);
+
+                // Add the file to the journal so the result is preserved for resume before the next full manifest save
+                lstAdd(fileJournal, &file->name);
             }
         }
         MEM_CONTEXT_TEMP_END();
@@ -1257,6 +1478,9 @@ backupManifestSaveCopy(Manifest *const manifest, const String *cipherPassBackup)
 
         // Save file
         manifestSave(manifest, write);
+
+        // The manifest copy now contains all journaled file results
+        backupManifestJournalRemove(manifest);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -1436,13 +1660,18 @@ typedef struct BackupJobData
 {
     const String *const backupLabel;                                // Backup label (defines the backup path)
     const bool backupStandby;                                       // Backup from standby
+    const CipherType cipherType;                                    // Cipher type used to encrypt files in the backup
     const String *const cipherSubPass;                              // Passphrase used to encrypt files in the backup
     const CompressType compressType;                                // Backup compression type
     const int compressLevel;                                        // Compress level if backup is compressed
+    const bool compressLevelAdaptive;                               // Adjust compress level based on throughput?
+    const bool checksumBlock;                                       // Store block checksums for delta restore?
     const bool delta;                                               // Is this a checksum delta backup?
+    const bool resume;                                              // Is this a resumed backup?
     const uint64_t lsnStart;                                        // Starting lsn for the backup
 
     List *queueList;                                                // List of processing queues
+    Progress *progress;                                             // Progress reporting
 } BackupJobData;
 
 static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx)
@@ -1489,10 +1718,18 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
                 protocolCommandParamAdd(command, VARUINT64(jobData->lsnStart));
                 protocolCommandParamAdd(command, VARSTR(file->name));
                 protocolCommandParamAdd(command, VARBOOL(file->reference != NULL));
-                protocolCommandParamAdd(command, VARUINT(jobData->compressType));
+                protocolCommandParamAdd(command, VARUINT(file->compressSkip ? compressTypeNone : jobData->compressType));
                 protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+                protocolCommandParamAdd(command, VARBOOL(jobData->compressLevelAdaptive));
+                protocolCommandParamAdd(
+                    command,
+                    VARUINT(
+                        jobData->checksumBlock && file->size > BACKUP_FILE_CHECKSUM_BLOCK_SIZE ?
+                            BACKUP_FILE_CHECKSUM_BLOCK_SIZE : 0));
                 protocolCommandParamAdd(command, VARSTR(jobData->backupLabel));
                 protocolCommandParamAdd(command, VARBOOL(jobData->delta));
+                protocolCommandParamAdd(command, VARBOOL(jobData->resume));
+                protocolCommandParamAdd(command, VARUINT(jobData->cipherType));
                 protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
 
                 // Remove job from the queue
@@ -1501,6 +1738,9 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
                 // Assign job to result
                 result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
 
+                // Report the file this worker is processing
+                progressWorkerSet(jobData->progress, clientIdx, file->name);
+
                 // Break out of the loop early since we found a job
                 break;
             }
@@ -1510,6 +1750,10 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
                 queueIdx = backupJobQueueNext(clientIdx, queueIdx, lstSize(jobData->queueList) - queueOffset);
         }
         while (queueIdx != queueEnd);
+
+        // No more jobs for this worker so report it as idle
+        if (result == NULL)
+            progressWorkerSet(jobData->progress, clientIdx, NULL);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -1517,13 +1761,15 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
 }
 
 static void
-backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart, const String *cipherPassBackup)
+backupProcess(
+    BackupData *backupData, Manifest *manifest, const String *lsnStart, const String *cipherPassBackup, bool resume)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM(STRING, lsnStart);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+        FUNCTION_LOG_PARAM(BOOL, resume);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
@@ -1583,8 +1829,12 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
             .backupStandby = backupStandby,
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .compressLevelAdaptive = cfgOptionBool(cfgOptCompressLevelAdaptive),
+            .checksumBlock = cfgOptionBool(cfgOptChecksumBlock),
+            .cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType)),
             .cipherSubPass = manifestCipherSubPass(manifest),
             .delta = cfgOptionBool(cfgOptDelta),
+            .resume = resume,
             .lsnStart = cfgOptionBool(cfgOptOnline) ? pgLsnFromStr(lsnStart) : 0xFFFFFFFFFFFFFFFF,
         };
 
@@ -1605,9 +1855,16 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
         for (unsigned int processIdx = 2; processIdx <= processMax; processIdx++)
             protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, pgIdx, processIdx));
 
+        // Report progress so the backup can be monitored while it is running
+        jobData.progress = progressNew(sizeTotal, processMax);
+
         // Maintain a list of files that need to be removed from the manifest when the backup is complete
         StringList *fileRemove = strLstNew();
 
+        // Maintain a list of files that have been copied since the last save so they can be written to the journal
+        List *fileJournal = lstNewP(sizeof(String *));
+        unsigned int journalSegmentIdx = 0;
+
         // Determine how often the manifest will be saved (every one percent or threshold size, whichever is greater)
         uint64_t manifestSaveLast = 0;
         uint64_t manifestSaveSize = sizeTotal / 100;
@@ -1634,16 +1891,24 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
                         storagePathP(
                             protocolParallelJobProcessId(job) > 1 ? storagePgIdx(pgIdx) : backupData->storagePrimary,
                             manifestPathPg(manifestFileFind(manifest, varStr(protocolParallelJobKey(job)))->name)),
-                        fileRemove, job, sizeTotal, sizeCopied);
+                        fileRemove, fileJournal, job, sizeTotal, sizeCopied);
                 }
 
                 // A keep-alive is required here for the remote holding open the backup connection
                 protocolKeepAlive();
 
-                // Save the manifest periodically to preserve checksums for resume
+                // Update progress periodically
+                progressUpdate(jobData.progress, sizeCopied);
+
+                // Save file results to the journal periodically to preserve checksums for resume
                 if (sizeCopied - manifestSaveLast >= manifestSaveSize)
                 {
-                    backupManifestSaveCopy(manifest, cipherPassBackup);
+                    if (!lstEmpty(fileJournal))
+                    {
+                        backupManifestJournalSave(manifest, fileJournal, ++journalSegmentIdx, cipherPassBackup);
+                        lstClear(fileJournal);
+                    }
+
                     manifestSaveLast = sizeCopied;
                 }
 
@@ -1654,6 +1919,9 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
         }
         MEM_CONTEXT_TEMP_END();
 
+        // Processing is complete so remove the progress status file
+        progressFree(jobData.progress);
+
 #ifdef DEBUG
         // Ensure that all processing queues are empty
         for (unsigned int queueIdx = 0; queueIdx < lstSize(jobData.queueList); queueIdx++)
@@ -1666,8 +1934,6 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
             manifestFileRemove(manifest, strLstGet(fileRemove, fileRemoveIdx));
 
         // Log references or create hardlinks for all files
-        const char *const compressExt = strZ(compressExtStr(jobData.compressType));
-
         for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(manifest); fileIdx++)
         {
             const ManifestFile *const file = manifestFile(manifest, fileIdx);
@@ -1681,6 +1947,9 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
                 {
                     LOG_DETAIL_FMT("hardlink %s to %s",  strZ(file->name), strZ(file->reference));
 
+                    const CompressType compressType = file->compressSkip ? compressTypeNone : jobData.compressType;
+                    const char *const compressExt = strZ(compressExtStr(compressType));
+
                     const String *const linkName = storagePathP(
                         storageRepo(), strNewFmt("%s/%s%s", strZ(backupPathExp), strZ(file->name), compressExt));
                     const String *const linkDestination =  storagePathP(
@@ -1711,6 +1980,7 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
         }
 
         LOG_INFO_FMT("%s backup size = %s", strZ(backupTypeStr(backupType)), strZ(strSizeFormat(sizeTotal)));
+        statBytesAdd(STRDEF("backup.copy"), sizeTotal);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -1775,6 +2045,12 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
                     CompressType archiveCompressType = compressTypeFromName(archiveFile);
                     CompressType backupCompressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType));
 
+                    // Compress/decompress if archive and backup do not have the same compression settings. A segment whose zero
+                    // tail was trimmed by archive-push must also be decompressed, padded, and compressed again, since the segment
+                    // in the backup must be full size for restore to check the size and checksum.
+                    const bool trimmed = walIsTrimmed(archiveFile);
+                    const bool recompress = archiveCompressType != backupCompressType || trimmed;
+
                     // Open the archive file
                     StorageRead *read = storageNewReadP(
                         storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(archiveFile)));
@@ -1785,15 +2061,15 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
                         filterGroup, cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeDecrypt,
                         infoArchiveCipherPass(infoArchive));
 
-                    // Compress/decompress if archive and backup do not have the same compression settings
-                    if (archiveCompressType != backupCompressType)
-                    {
-                        if (archiveCompressType != compressTypeNone)
-                            ioFilterGroupAdd(filterGroup, decompressFilter(archiveCompressType));
+                    if (recompress && archiveCompressType != compressTypeNone)
+                        ioFilterGroupAdd(filterGroup, decompressFilter(archiveCompressType));
 
-                        if (backupCompressType != compressTypeNone)
-                            ioFilterGroupAdd(filterGroup, compressFilter(backupCompressType, cfgOptionInt(cfgOptCompressLevel)));
-                    }
+                    // Restore the zero tail
+                    if (trimmed)
+                        ioFilterGroupAdd(filterGroup, walTailPadNew());
+
+                    if (recompress && backupCompressType != compressTypeNone)
+                        ioFilterGroupAdd(filterGroup, compressFilter(backupCompressType, cfgOptionInt(cfgOptCompressLevel)));
 
                     // Encrypt with backup key if encrypted
                     cipherBlockFilterGroupAdd(
@@ -1957,8 +2233,10 @@ cmdBackup(void)
         // Check if there is a prior manifest when backup type is diff/incr
         Manifest *manifestPrior = backupBuildIncrPrior(infoBackup);
 
-        // Start the backup
+        // Start the backup. Time spent in each phase is recorded so it can be reported in the statistics at command end.
+        TimeUSec phaseBegin = timeUSec();
         BackupStartResult backupStartResult = backupStart(backupData);
+        phaseBegin = statTimeEnd(STRDEF("backup.start"), phaseBegin);
 
         // Build the manifest
         Manifest *manifest = manifestNewBuild(
@@ -1978,7 +2256,9 @@ cmdBackup(void)
             cfgOptionSet(cfgOptDelta, cfgSourceParam, BOOL_TRUE_VAR);
 
         // Resume a backup when possible
-        if (!backupResume(manifest, cipherPassBackup))
+        const bool resume = backupResume(manifest, cipherPassBackup);
+
+        if (!resume)
         {
             manifestBackupLabelSet(
                 manifest,
@@ -1987,12 +2267,15 @@ cmdBackup(void)
 
         // Save the manifest before processing starts
         backupManifestSaveCopy(manifest, cipherPassBackup);
+        phaseBegin = statTimeEnd(STRDEF("backup.manifest"), phaseBegin);
 
         // Process the backup manifest
-        backupProcess(backupData, manifest, backupStartResult.lsn, cipherPassBackup);
+        backupProcess(backupData, manifest, backupStartResult.lsn, cipherPassBackup, resume);
+        phaseBegin = statTimeEnd(STRDEF("backup.copy"), phaseBegin);
 
         // Stop the backup
         BackupStopResult backupStopResult = backupStop(backupData, manifest);
+        phaseBegin = statTimeEnd(STRDEF("backup.stop"), phaseBegin);
 
         // Complete manifest
         manifestBuildComplete(
@@ -2008,6 +2291,7 @@ cmdBackup(void)
 
         // Check and copy WAL segments required to make the backup consistent
         backupArchiveCheckCopy(manifest, backupData->walSegmentSize, cipherPassBackup);
+        phaseBegin = statTimeEnd(STRDEF("backup.archive"), phaseBegin);
 
         // The primary protocol connection won't be used anymore so free it. This needs to happen after backupArchiveCheckCopy() so
         // the backup lock is held on the remote which allows conditional archiving based on the backup lock. Any further access to
@@ -2017,6 +2301,7 @@ cmdBackup(void)
         // Complete the backup
         LOG_INFO_FMT("new backup label = %s", strZ(manifestData(manifest)->backupLabel));
         backupComplete(infoBackup, manifest);
+        statTimeEnd(STRDEF("backup.complete"), phaseBegin);
     }
     MEM_CONTEXT_TEMP_END();
 
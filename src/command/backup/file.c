@@ -9,16 +9,24 @@ Backup File
 #include "command/backup/pageChecksum.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
+#include "common/crypto/hashBlock.h"
 #include "common/debug.h"
 #include "common/io/filter/group.h"
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
 #include "common/regExp.h"
+#include "common/time.h"
 #include "common/type/convert.h"
+#include "info/manifest.h"
 #include "postgres/interface.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Files smaller than this are not probed for compressibility since the savings would not be worth the extra read
+***********************************************************************************************************************************/
+#define BACKUP_FILE_PROBE_SIZE_MIN                                  ((uint64_t)1024 * 1024)
+
 /***********************************************************************************************************************************
 Helper functions
 ***********************************************************************************************************************************/
@@ -33,12 +41,74 @@ segmentNumber(const String *pgFile)
     FUNCTION_TEST_RETURN(regExpMatchOne(STRDEF("\\.[0-9]+$"), pgFile) ? cvtZToUInt(strrchr(strZ(pgFile), '.') + 1) : 0);
 }
 
+// Copy the file like storageCopy() but time reads (which include compression) separately from writes so the adaptive compress level
+// can be adjusted. Timestamps are chained so no time is lost between intervals even though the resolution is coarse.
+static bool
+backupFileCopyAdaptive(StorageRead *source, StorageWrite *destination, CompressType compressType)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_READ, source);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, destination);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+    FUNCTION_LOG_END();
+
+    ASSERT(source != NULL);
+    ASSERT(destination != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Open source file
+        if (ioReadOpen(storageReadIo(source)))
+        {
+            // Open the destination file now that we know the source file exists and is readable
+            ioWriteOpen(storageWriteIo(destination));
+
+            // Copy data from source to destination
+            Buffer *read = bufNew(ioBufferSize());
+            TimeMSec produceTime = 0;
+            TimeMSec sinkTime = 0;
+            TimeMSec timeBegin = timeMSec();
+
+            do
+            {
+                ioRead(storageReadIo(source), read);
+
+                TimeMSec timeRead = timeMSec();
+                produceTime += timeRead - timeBegin;
+
+                ioWrite(storageWriteIo(destination), read);
+                bufUsedZero(read);
+
+                timeBegin = timeMSec();
+                sinkTime += timeBegin - timeRead;
+            }
+            while (!ioReadEof(storageReadIo(source)));
+
+            // Close the source and destination files. Closing flushes the final compressed data so it counts as a write.
+            ioReadClose(storageReadIo(source));
+            ioWriteClose(storageWriteIo(destination));
+            sinkTime += timeMSec() - timeBegin;
+
+            compressLevelAdaptiveUpdate(compressType, produceTime, sinkTime);
+
+            // Set result to indicate that the file was copied
+            result = true;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /**********************************************************************************************************************************/
 BackupFileResult
 backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
     bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
-    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
+    CompressType repoFileCompressType, int repoFileCompressLevel, bool repoFileCompressLevelAdaptive,
+    unsigned int repoFileChecksumBlockSize, const String *backupLabel, bool delta, bool resume, CipherType cipherType,
     const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
@@ -53,8 +123,11 @@ backupFile(
         FUNCTION_LOG_PARAM(BOOL, repoFileHasReference);             // Does the repo file exist in a prior backup in the set?
         FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);             // Compress type for repo file
         FUNCTION_LOG_PARAM(INT,  repoFileCompressLevel);            // Compression level for repo file
+        FUNCTION_LOG_PARAM(BOOL, repoFileCompressLevelAdaptive);    // Adjust compression level based on throughput?
+        FUNCTION_LOG_PARAM(UINT, repoFileChecksumBlockSize);        // Block size for block checksums (0 to not store them)
         FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
         FUNCTION_LOG_PARAM(BOOL, delta);                            // Is the delta option on?
+        FUNCTION_LOG_PARAM(BOOL, resume);                           // Is the backup being resumed?
         FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
     FUNCTION_LOG_END();
@@ -195,6 +268,27 @@ backupFile(
             // Is the file compressible during the copy?
             bool compressible = repoFileCompressType == compressTypeNone && cipherType == cipherTypeNone;
 
+            // If a sample from the start of a large file looks incompressible then store the file without compression to save CPU
+            CompressType compressType = repoFileCompressType;
+
+            if (compressType != compressTypeNone && pgFileSize >= BACKUP_FILE_PROBE_SIZE_MIN)
+            {
+                const Buffer *const sample = storageGetP(
+                    storageNewReadP(
+                        storagePg(), pgFile, .ignoreMissing = pgFileIgnoreMissing, .limit = VARUINT64(COMPRESS_PROBE_SIZE)));
+
+                if (sample != NULL && !compressProbe(sample))
+                {
+                    // Remove the compressed file if it is being recopied so it is not left behind in the backup
+                    if (result.backupCopyResult == backupCopyResultReCopy)
+                        storageRemoveP(storageRepoWrite(), repoPathFile);
+
+                    compressType = compressTypeNone;
+                    repoPathFile = strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(backupLabel), strZ(repoFile));
+                    result.compressSkip = true;
+                }
+            }
+
             // Setup pg file for read. Only read as many bytes as passed in pgFileSize.  If the file is growing it does no good to
             // copy data past the end of the size recorded in the manifest since those blocks will need to be replayed from WAL
             // during recovery.
@@ -204,6 +298,10 @@ backupFile(
             ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashNew(HASH_TYPE_SHA1_STR));
             ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), ioSizeNew());
 
+            // Add block checksum filter
+            if (repoFileChecksumBlockSize != 0)
+                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashBlockNew(repoFileChecksumBlockSize));
+
             // Add page checksum filter
             if (pgFileChecksumPage)
             {
@@ -212,11 +310,18 @@ backupFile(
                     pgFileChecksumPageLsnLimit));
             }
 
-            // Add compression
-            if (repoFileCompressType != compressTypeNone)
+            // Add compression. When the level is adaptive use the current level for this process rather than the level passed.
+            const bool compressAdaptive = compressType != compressTypeNone && repoFileCompressLevelAdaptive;
+
+            if (compressType != compressTypeNone)
             {
-                ioFilterGroupAdd(
-                    ioReadFilterGroup(storageReadIo(read)), compressFilter(repoFileCompressType, repoFileCompressLevel));
+                const int compressLevel = compressAdaptive ?
+                    compressLevelAdaptive(compressType, repoFileCompressLevel) : repoFileCompressLevel;
+
+                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), compressFilter(compressType, compressLevel));
+
+                if (compressAdaptive)
+                    result.compressLevel = (unsigned int)compressLevel;
             }
 
             // If there is a cipher then add the encrypt filter
@@ -227,12 +332,15 @@ backupFile(
                         storageReadIo(read)), cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
             }
 
-            // Setup the repo file for write
-            StorageWrite *write = storageNewWriteP(storageRepoWrite(), repoPathFile, .compressible = compressible);
+            // Setup the repo file for write. When the backup is resumed also resume an upload of the file left unfinished by the
+            // interrupted backup so parts with the same content do not need to be uploaded again. The file will not be read again
+            // by the backup so it is written behind.
+            StorageWrite *write = storageNewWriteP(
+                storageRepoWrite(), repoPathFile, .compressible = compressible, .resume = resume, .writeBehind = true);
             ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), ioSizeNew());
 
             // Open the source and destination and copy the file
-            if (storageCopy(read, write))
+            if (compressAdaptive ? backupFileCopyAdaptive(read, write, compressType) : storageCopy(read, write))
             {
                 MEM_CONTEXT_PRIOR_BEGIN()
                 {
@@ -252,6 +360,35 @@ backupFile(
                     }
                 }
                 MEM_CONTEXT_PRIOR_END();
+
+                // Store the block checksums in the repo so a delta restore can rewrite only the blocks that differ. They are
+                // encrypted like the file since they are derived from its contents. The checksum of the block checksums is
+                // recorded in the manifest with the file so they can be verified.
+                if (repoFileChecksumBlockSize != 0)
+                {
+                    const Buffer *const blockChecksum = BUFSTR(
+                        varStr(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), CRYPTO_HASH_BLOCK_FILTER_TYPE_STR)));
+
+                    StorageWrite *const blockWrite = storageNewWriteP(
+                        storageRepoWrite(),
+                        strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(backupLabel), strZ(repoFile)));
+
+                    if (cipherType != cipherTypeNone)
+                    {
+                        ioFilterGroupAdd(
+                            ioWriteFilterGroup(storageWriteIo(blockWrite)),
+                            cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
+                    }
+
+                    storagePutP(blockWrite, blockChecksum);
+
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        result.checksumBlockSize = repoFileChecksumBlockSize;
+                        result.checksumBlockSha1 = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, blockChecksum));
+                    }
+                    MEM_CONTEXT_PRIOR_END();
+                }
             }
             // Else if source file is missing and the read setup indicated ignore a missing file, the database removed it so skip it
             else
@@ -8,6 +8,12 @@ Backup File
 #include "common/crypto/common.h"
 #include "common/type/keyValue.h"
 
+/***********************************************************************************************************************************
+Block size used when storing block checksums. Files no larger than one block do not get block checksums since the file checksum is
+sufficient.
+***********************************************************************************************************************************/
+#define BACKUP_FILE_CHECKSUM_BLOCK_SIZE                             ((unsigned int)128 * 1024)
+
 /***********************************************************************************************************************************
 Backup file types
 ***********************************************************************************************************************************/
@@ -31,12 +37,17 @@ typedef struct BackupFileResult
     String *copyChecksum;
     uint64_t repoSize;
     KeyValue *pageChecksumResult;
+    unsigned int compressLevel;                                     // Compress level used when adaptive (0 if not adaptive)
+    bool compressSkip;                                              // Was compression skipped because the file is incompressible?
+    unsigned int checksumBlockSize;                                 // Block size of the stored block checksums (0 if not stored)
+    String *checksumBlockSha1;                                      // SHA1 checksum of the stored block checksums
 } BackupFileResult;
 
 BackupFileResult backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
     bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
-    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
+    CompressType repoFileCompressType, int repoFileCompressLevel, bool repoFileCompressLevelAdaptive,
+    unsigned int repoFileChecksumBlockSize, const String *backupLabel, bool delta, bool resume, CipherType cipherType,
     const String *cipherPass);
 
 #endif
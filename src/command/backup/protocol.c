@@ -42,8 +42,9 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
                 varBool(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)), varBool(varLstGet(paramList, 5)),
                 varUInt64(varLstGet(paramList, 6)), varStr(varLstGet(paramList, 7)), varBool(varLstGet(paramList, 8)),
                 (CompressType)varUIntForce(varLstGet(paramList, 9)), varIntForce(varLstGet(paramList, 10)),
-                varStr(varLstGet(paramList, 11)), varBool(varLstGet(paramList, 12)),
-                varStr(varLstGet(paramList, 13)) == NULL ? cipherTypeNone : cipherTypeAes256Cbc, varStr(varLstGet(paramList, 13)));
+                varBool(varLstGet(paramList, 11)), varUIntForce(varLstGet(paramList, 12)), varStr(varLstGet(paramList, 13)),
+                varBool(varLstGet(paramList, 14)), varBool(varLstGet(paramList, 15)),
+                (CipherType)varUIntForce(varLstGet(paramList, 16)), varStr(varLstGet(paramList, 17)));
 
             // Return backup result
             VariantList *resultList = varLstNew();
@@ -52,6 +53,10 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
             varLstAdd(resultList, varNewUInt64(result.repoSize));
             varLstAdd(resultList, varNewStr(result.copyChecksum));
             varLstAdd(resultList, result.pageChecksumResult != NULL ? varNewKv(result.pageChecksumResult) : NULL);
+            varLstAdd(resultList, varNewUInt(result.compressLevel));
+            varLstAdd(resultList, varNewBool(result.compressSkip));
+            varLstAdd(resultList, varNewUInt(result.checksumBlockSize));
+            varLstAdd(resultList, varNewStr(result.checksumBlockSha1));
 
             protocolServerResponse(server, varNewVarLst(resultList));
         }
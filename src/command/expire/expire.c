@@ -6,6 +6,7 @@ Expire Command
 #include "command/archive/common.h"
 #include "command/backup/common.h"
 #include "command/control/common.h"
+#include "command/expire/protocol.h"
 #include "common/time.h"
 #include "common/type/list.h"
 #include "common/debug.h"
@@ -15,6 +16,7 @@ Expire Command
 #include "info/infoBackup.h"
 #include "info/manifest.h"
 #include "protocol/helper.h"
+#include "protocol/parallel.h"
 #include "storage/helper.h"
 
 #include <stdlib.h>
@@ -35,6 +37,178 @@ typedef struct ArchiveRange
     const String *stop;
 } ArchiveRange;
 
+// Path to remove or, when fileList is set, files to remove from the path
+typedef struct ExpireRemove
+{
+    const String *path;
+    StringList *fileList;
+} ExpireRemove;
+
+/***********************************************************************************************************************************
+Add a path (file is NULL) or a file in a path to the list of removals. Files in the same path are batched together so drivers that
+support bulk removal can remove them with fewer requests.
+***********************************************************************************************************************************/
+static void
+expireRemoveAdd(List *removeList, const String *path, const String *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, removeList);
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM(STRING, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(removeList != NULL);
+    ASSERT(path != NULL);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(removeList))
+    {
+        if (file == NULL)
+            lstAdd(removeList, &(ExpireRemove){.path = strDup(path)});
+        else
+        {
+            ExpireRemove *remove = lstEmpty(removeList) ? NULL : lstGetLast(removeList);
+
+            // Start a new batch when the last removal was for a different path
+            if (remove == NULL || remove->fileList == NULL || !strEq(remove->path, path))
+            {
+                lstAdd(removeList, &(ExpireRemove){.path = strDup(path), .fileList = strLstNew()});
+                remove = lstGetLast(removeList);
+            }
+
+            strLstAdd(remove->fileList, file);
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Job callback for parallel removal
+***********************************************************************************************************************************/
+typedef struct ExpireJobData
+{
+    const List *removeList;                                         // Removals to process
+    unsigned int removeIdx;                                         // Next removal to process
+    unsigned int repoIdx;                                           // Repo to remove from
+} ExpireJobData;
+
+static ProtocolParallelJob *
+expireJobCallback(void *data, unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+
+    // No special logic based on the client, we'll just get the next removal in the list
+    (void)clientIdx;
+
+    ProtocolParallelJob *result = NULL;
+    ExpireJobData *jobData = data;
+
+    if (jobData->removeIdx < lstSize(jobData->removeList))
+    {
+        const ExpireRemove *remove = lstGet(jobData->removeList, jobData->removeIdx);
+        jobData->removeIdx++;
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_EXPIRE_REMOVE_STR);
+            protocolCommandParamAdd(command, VARUINT(jobData->repoIdx));
+            protocolCommandParamAdd(command, VARSTR(remove->path));
+            protocolCommandParamAdd(command, remove->fileList != NULL ? varNewVarLst(varLstNewStrLst(remove->fileList)) : NULL);
+
+            result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(remove->path), command), memContextPrior());
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Perform the removals in the list. When process-max is greater than one the removals are distributed to local processes so paths and
+batches are removed concurrently, which matters most for object stores where each request has high latency.
+***********************************************************************************************************************************/
+static void
+expireRemove(const List *removeList, unsigned int repoIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(LIST, removeList);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(removeList != NULL);
+
+    if (!lstEmpty(removeList))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const unsigned int processMax = cfgOptionUInt(cfgOptProcessMax);
+
+            // Remove in this process when there is only one process or only one removal
+            if (processMax == 1 || lstSize(removeList) == 1)
+            {
+                for (unsigned int removeIdx = 0; removeIdx < lstSize(removeList); removeIdx++)
+                {
+                    const ExpireRemove *remove = lstGet(removeList, removeIdx);
+
+                    if (remove->fileList == NULL)
+                        storagePathRemoveP(storageRepoIdxWrite(repoIdx), remove->path, .recurse = true);
+                    else
+                        storageRemoveListP(storageRepoIdxWrite(repoIdx), remove->path, remove->fileList);
+                }
+            }
+            // Else distribute the removals to local processes
+            else
+            {
+                ExpireJobData jobData = {.removeList = removeList, .repoIdx = repoIdx};
+
+                // Local processes may be left over from a backup run with a different storage type so start them fresh
+                for (unsigned int processIdx = 1; processIdx <= processMax; processIdx++)
+                    protocolLocalFree(processIdx);
+
+                ProtocolParallel *parallelExec = protocolParallelNew(
+                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, expireJobCallback, &jobData);
+
+                for (unsigned int processIdx = 1; processIdx <= processMax; processIdx++)
+                    protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, repoIdx, processIdx));
+
+                unsigned int removeCompleted = 0;
+
+                do
+                {
+                    unsigned int completed = protocolParallelProcess(parallelExec);
+
+                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                    {
+                        ProtocolParallelJob *job = protocolParallelResult(parallelExec);
+
+                        if (protocolParallelJobErrorCode(job) != 0)
+                            THROW_CODE(protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
+
+                        removeCompleted++;
+
+                        LOG_DETAIL_PID_FMT(
+                            protocolParallelJobProcessId(job), "repo%u: removed %s (%u/%u)",
+                            cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx), strZ(varStr(protocolParallelJobKey(job))),
+                            removeCompleted, lstSize(removeList));
+
+                        protocolParallelJobFree(job);
+                    }
+                }
+                while (!protocolParallelDone(parallelExec));
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Given a backup label, expire a backup and all its dependents (if any).
 ***********************************************************************************************************************************/
@@ -379,6 +553,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
+        // Removals are collected and performed together once all expired archive has been determined
+        List *removeList = lstNewP(sizeof(ExpireRemove));
+
         // Get the retention options. repo-archive-retention-type always has a value as it defaults to "full"
         const String *archiveRetentionType = cfgOptionIdxStr(cfgOptRepoRetentionArchiveType, repoIdx);
         unsigned int archiveRetention = cfgOptionIdxTest(
@@ -529,7 +706,7 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
 
                                 // Execute the real expiration and deletion only if the dry-run option is disabled
                                 if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
-                                    storagePathRemoveP(storageRepoIdxWrite(repoIdx), fullPath, .recurse = true);
+                                    expireRemoveAdd(removeList, fullPath, NULL);
                             }
 
                             // Continue to next directory
@@ -659,10 +836,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                     // Execute the real expiration and deletion only if the dry-run mode is disabled
                                     if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                     {
-                                        storagePathRemoveP(
-                                            storageRepoIdxWrite(repoIdx),
-                                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
-                                            .recurse = true);
+                                        expireRemoveAdd(
+                                            removeList, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
+                                            NULL);
                                     }
 
                                     archiveExpire.total++;
@@ -708,11 +884,10 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                             // Execute the real expiration and deletion only if the dry-run mode is disabled
                                             if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                             {
-                                                storageRemoveP(
-                                                    storageRepoIdxWrite(repoIdx),
-                                                    strNewFmt(
-                                                        STORAGE_REPO_ARCHIVE "/%s/%s/%s", strZ(archiveId), strZ(walPath),
-                                                        strZ(walSubPath)));
+                                                expireRemoveAdd(
+                                                    removeList,
+                                                    strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
+                                                    walSubPath);
                                             }
 
                                             // Track that this archive was removed
@@ -759,9 +934,8 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                     // Execute the real expiration and deletion only if the dry-run mode is disabled
                                     if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                     {
-                                        storageRemoveP(
-                                            storageRepoIdxWrite(repoIdx),
-                                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(historyFile)));
+                                        expireRemoveAdd(
+                                            removeList, strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(archiveId)), historyFile);
                                     }
 
                                     LOG_DETAIL_FMT(
@@ -775,6 +949,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                 }
             }
         }
+
+        // Remove expired archive
+        expireRemove(removeList, repoIdx);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -827,7 +1004,7 @@ removeExpiredBackup(InfoBackup *infoBackup, const String *adhocBackupLabel, unsi
             // Else it may be related to the adhoc backup so check if its ancestor still exists
             else
             {
-                Manifest *manifestResume = manifestLoadFile(
+                Manifest *manifestResume = manifestLoadFileSummary(
                     storageRepoIdx(repoIdx), manifestFileName, cipherType(cfgOptionIdxStr(cfgOptRepoCipherType, repoIdx)),
                     infoPgCipherPass(infoBackupPg(infoBackup)));
 
@@ -839,6 +1016,8 @@ removeExpiredBackup(InfoBackup *infoBackup, const String *adhocBackupLabel, unsi
     }
 
     // Remove non-current backups from disk
+    List *removeList = lstNewP(sizeof(ExpireRemove));
+
     for (; backupIdx < strLstSize(backupList); backupIdx++)
     {
         if (!strLstExists(currentBackupList, strLstGet(backupList, backupIdx)))
@@ -850,13 +1029,14 @@ removeExpiredBackup(InfoBackup *infoBackup, const String *adhocBackupLabel, unsi
             // Execute the real expiration and deletion only if the dry-run mode is disabled
             if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
             {
-                storagePathRemoveP(
-                    storageRepoIdxWrite(repoIdx), strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(strLstGet(backupList, backupIdx))),
-                    .recurse = true);
+                expireRemoveAdd(
+                    removeList, strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(strLstGet(backupList, backupIdx))), NULL);
             }
         }
     }
 
+    expireRemove(removeList, repoIdx);
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
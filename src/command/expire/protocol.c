@@ -0,0 +1,55 @@
+/***********************************************************************************************************************************
+Expire Protocol Handler
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/expire/protocol.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+STRING_EXTERN(PROTOCOL_COMMAND_EXPIRE_REMOVE_STR,                   PROTOCOL_COMMAND_EXPIRE_REMOVE);
+
+/**********************************************************************************************************************************/
+bool
+expireProtocol(const String *command, const VariantList *paramList, ProtocolServer *server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, command);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, paramList);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(command != NULL);
+
+    // Attempt to satisfy the request -- we may get requests that are meant for other handlers
+    bool found = true;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Process any commands received that are for this handler
+        if (strEq(command, PROTOCOL_COMMAND_EXPIRE_REMOVE_STR))
+        {
+            const Storage *storage = storageRepoIdxWrite(varUIntForce(varLstGet(paramList, 0)));    // Repo index
+            const String *path = varStr(varLstGet(paramList, 1));                                   // Path
+            const Variant *fileList = varLstGet(paramList, 2);                                      // Files in path (or NULL)
+
+            // Remove the path when there is no file list, else remove the files in the path
+            if (fileList == NULL)
+                storagePathRemoveP(storage, path, .recurse = true);
+            else
+                storageRemoveListP(storage, path, strLstNewVarLst(varVarLst(fileList)));
+
+            protocolServerResponse(server, NULL);
+        }
+        else
+            found = false;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, found);
+}
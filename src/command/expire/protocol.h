@@ -0,0 +1,23 @@
+/***********************************************************************************************************************************
+Expire Protocol Handler
+***********************************************************************************************************************************/
+#ifndef COMMAND_EXPIRE_PROTOCOL_H
+#define COMMAND_EXPIRE_PROTOCOL_H
+
+#include "common/type/string.h"
+#include "common/type/variantList.h"
+#include "protocol/server.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+#define PROTOCOL_COMMAND_EXPIRE_REMOVE                              "expireRemove"
+    STRING_DECLARE(PROTOCOL_COMMAND_EXPIRE_REMOVE_STR);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Process protocol requests
+bool expireProtocol(const String *command, const VariantList *paramList, ProtocolServer *server);
+
+#endif
@@ -113,7 +113,7 @@ static const unsigned char helpDataPack[] =
         pckTypeStr << 4 | 0x09, 0x25, // Summary
             0x45, 0x78, 0x70, 0x69, 0x72, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
             0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x20, 0x72, 0x65, 0x74, 0x65, 0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
-        pckTypeStr << 4 | 0x08, 0xE3, 0x08, // Description
+        pckTypeStr << 4 | 0x08, 0xDE, 0x0A, // Description
             0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x66, 0x75, 0x6C, 0x6C,
             0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x72, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x61, 0x73,
             0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x65, 0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x20,
@@ -170,7 +170,20 @@ static const unsigned char helpDataPack[] =
             0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64,
             0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20,
             0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x70, 0x69, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x69,
-            0x73, 0x20, 0x72, 0x75, 0x6E, 0x2E,
+            0x73, 0x20, 0x72, 0x75, 0x6E, 0x2E, 0x0A, 0x0A,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x69, 0x73, 0x20,
+            0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x2C, 0x20, 0x65, 0x78,
+            0x70, 0x69, 0x72, 0x65, 0x64, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72,
+            0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6E,
+            0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x20, 0x62, 0x79, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70,
+            0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x2E, 0x20, 0x41, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x62,
+            0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
+            0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x6E,
+            0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x72,
+            0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x62, 0x75, 0x6C, 0x6B,
+            0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x73, 0x2E,
 
         // help command
         // -------------------------------------------------------------------------------------------------------------------------
@@ -751,6 +764,55 @@ static const unsigned char helpDataPack[] =
             0x61, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x63,
             0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
 
+        // archive-push-ahead option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x2A, // Summary
+            0x50, 0x75, 0x73, 0x68, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65,
+            0x6E, 0x74, 0x73, 0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65,
+            0x6C, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xF5, 0x05, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69,
+            0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x70, 0x75, 0x73, 0x68, 0x20, 0x57, 0x41, 0x4C,
+            0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72,
+            0x65, 0x61, 0x64, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x5F, 0x73, 0x74, 0x61, 0x74,
+            0x75, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+            0x65, 0x64, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61,
+            0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+            0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D,
+            0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64,
+            0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67,
+            0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x2C, 0x20, 0x73, 0x6F, 0x20,
+            0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x72,
+            0x63, 0x68, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x75, 0x70, 0x2E, 0x20, 0x54, 0x68,
+            0x69, 0x73, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x6C,
+            0x61, 0x67, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x2D, 0x70, 0x61, 0x74, 0x68,
+            0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20,
+            0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x69,
+            0x6E, 0x67, 0x2E, 0x0A, 0x0A,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x6C, 0x61, 0x74, 0x65,
+            0x72, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67,
+            0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64,
+            0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x2C, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x63,
+            0x68, 0x65, 0x63, 0x6B, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72,
+            0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x41, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+            0x72, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x72,
+            0x65, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+            0x61, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x72, 0x61, 0x74,
+            0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x61, 0x20, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x2E, 0x20,
+            0x45, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E,
+            0x74, 0x73, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x6C, 0x6F, 0x67, 0x67, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x77, 0x68, 0x65,
+            0x6E, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2E,
+
         // archive-push-queue-max option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -808,10 +870,58 @@ static const unsigned char helpDataPack[] =
                 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2D, 0x6D, 0x61, 0x78,
         0x00, // Deprecated names end
 
-        // archive-timeout option
+        // archive-push-trim option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0A, 0x07, // Section
             0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x32, // Summary
+            0x44, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x7A, 0x65, 0x72,
+            0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x57, 0x41, 0x4C,
+            0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xE4, 0x05, // Description
+            0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x50, 0x6F,
+            0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x65,
+            0x66, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x2C,
+            0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72, 0x63,
+            0x68, 0x69, 0x76, 0x65, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x2C, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61,
+            0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x61, 0x66,
+            0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x2E,
+            0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69,
+            0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x73, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73,
+            0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x7A, 0x65, 0x72, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x2E, 0x20, 0x54, 0x68,
+            0x65, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x62,
+            0x79, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66,
+            0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+            0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x63, 0x6F, 0x70, 0x79, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x50, 0x6F, 0x73, 0x74,
+            0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x61,
+            0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65,
+            0x6E, 0x74, 0x2E, 0x0A, 0x0A,
+            0x54, 0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x2E,
+            0x74, 0x72, 0x69, 0x6D, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72,
+            0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x65, 0x78,
+            0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x6B,
+            0x6E, 0x6F, 0x77, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+            0x61, 0x69, 0x6C, 0x2E, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x67, 0x42,
+            0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x64, 0x6F, 0x20,
+            0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x67, 0x6E, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x65,
+            0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x72, 0x74, 0x20, 0x74, 0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67,
+            0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x61, 0x74,
+            0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74,
+            0x68, 0x65, 0x6D, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x2E, 0x20, 0x54, 0x61, 0x69, 0x6C, 0x73, 0x20, 0x74, 0x68, 0x61,
+            0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65,
+            0x64, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x64, 0x20,
+            0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74,
+            0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2E,
+
+        // archive-timeout option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
         pckTypeStr << 4 | 0x08, 0x10, // Summary
             0x41, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x2E,
         pckTypeStr << 4 | 0x08, 0xE9, 0x01, // Description
@@ -882,6 +992,45 @@ static const unsigned char helpDataPack[] =
             0x2C, 0x20, 0x38, 0x33, 0x38, 0x38, 0x36, 0x30, 0x38, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x36, 0x37, 0x37, 0x37,
             0x32, 0x31, 0x36, 0x2E,
 
+        // checksum-block option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        pckTypeStr << 4 | 0x08, 0x28, // Summary
+            0x53, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D,
+            0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xC2, 0x04, // Description
+            0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x73, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x74,
+            0x6F, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x61, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x66,
+            0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x31, 0x32, 0x38, 0x4B, 0x69, 0x42, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+            0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+            0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x20, 0x41, 0x20, 0x64, 0x65, 0x6C, 0x74, 0x61,
+            0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68,
+            0x65, 0x73, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x72, 0x65, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C,
+            0x6F, 0x63, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x20, 0x72, 0x61, 0x74,
+            0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x61, 0x63,
+            0x68, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x75,
+            0x6C, 0x6C, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x6D,
+            0x75, 0x63, 0x68, 0x20, 0x63, 0x68, 0x65, 0x61, 0x70, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x79, 0x6E,
+            0x63, 0x68, 0x72, 0x6F, 0x6E, 0x69, 0x7A, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x2C, 0x20,
+            0x65, 0x2E, 0x67, 0x2E, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x62, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x61, 0x74,
+            0x20, 0x68, 0x61, 0x73, 0x20, 0x64, 0x69, 0x76, 0x65, 0x72, 0x67, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73,
+            0x6C, 0x69, 0x67, 0x68, 0x74, 0x6C, 0x79, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63,
+            0x6B, 0x75, 0x70, 0x2E, 0x0A, 0x0A,
+            0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69,
+            0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6C, 0x6F, 0x6E, 0x67, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+            0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x64, 0x64, 0x20, 0x61, 0x20, 0x73, 0x6D, 0x61, 0x6C,
+            0x6C, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x43, 0x50, 0x55, 0x20, 0x6F, 0x76, 0x65, 0x72,
+            0x68, 0x65, 0x61, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E, 0x20,
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F,
+            0x6D, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x68, 0x61, 0x76,
+            0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x20, 0x6F, 0x6E,
+            0x6C, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20,
+            0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E,
+
         // checksum-page option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x06, // Section
@@ -961,6 +1110,36 @@ static const unsigned char helpDataPack[] =
             0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x3D, 0x79, 0x20,
             0x28, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x29, 0x2E,
 
+        // compress-level-adaptive option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x26, // Summary
+            0x41, 0x64, 0x61, 0x70, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x65,
+            0x76, 0x65, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x9A, 0x03, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62,
+            0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73,
+            0x20, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20,
+            0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73, 0x70,
+            0x65, 0x6E, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+            0x61, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73, 0x70, 0x65,
+            0x6E, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69,
+            0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6C, 0x65, 0x6E, 0x65, 0x63, 0x6B,
+            0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72,
+            0x6B, 0x29, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x72, 0x61, 0x69, 0x73,
+            0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F,
+            0x6E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6C, 0x65, 0x6E, 0x65, 0x63, 0x6B, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x65, 0x64,
+            0x20, 0x74, 0x6F, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x75, 0x70, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x76,
+            0x65, 0x6C, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74, 0x2E,
+
         // compress-level-network option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1144,6 +1323,48 @@ static const unsigned char helpDataPack[] =
             0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2D, 0x74,
             0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
 
+        // decode-host option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+        pckTypeStr << 4 | 0x08, 0x39, // Summary
+            0x48, 0x6F, 0x73, 0x74, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xCE, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20,
+            0x69, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x2C,
+            0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x63, 0x72, 0x79, 0x70,
+            0x74, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64,
+            0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67,
+            0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+            0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x6F, 0x72,
+            0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68,
+            0x6F, 0x73, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x44, 0x65, 0x63, 0x6F, 0x64, 0x69, 0x6E,
+            0x67, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20,
+            0x68, 0x6F, 0x73, 0x74, 0x20, 0x66, 0x72, 0x65, 0x65, 0x73, 0x20, 0x43, 0x50, 0x55, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x61, 0x74,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65,
+            0x72, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x64,
+            0x61, 0x74, 0x61, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x67, 0x6F, 0x6F, 0x64,
+            0x20, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x74,
+            0x77, 0x6F, 0x72, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76,
+            0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x50, 0x55, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62,
+            0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C,
+            0x20, 0x68, 0x6F, 0x73, 0x74, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x73, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x3A, 0x0A, 0x0A,
+            0x2A, 0x20, 0x70, 0x67, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20,
+            0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F,
+            0x73, 0x74, 0x2E, 0x0A,
+            0x2A, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x73, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20,
+            0x68, 0x6F, 0x73, 0x74, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x65,
+            0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73,
+            0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x2E,
+
         // delta option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -2464,7 +2685,7 @@ static const unsigned char helpDataPack[] =
         pckTypeStr << 4 | 0x08, 0x26, // Summary
             0x43, 0x69, 0x70, 0x68, 0x65, 0x72, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79,
             0x70, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E,
-        pckTypeStr << 4 | 0x08, 0x89, 0x02, // Description
+        pckTypeStr << 4 | 0x08, 0x8D, 0x03, // Description
             0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x69, 0x70, 0x68, 0x65, 0x72,
             0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
             0x3A, 0x0A, 0x0A,
@@ -2474,7 +2695,14 @@ static const unsigned char helpDataPack[] =
             0x2A, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x63, 0x62, 0x63, 0x20, 0x2D, 0x20, 0x41, 0x64, 0x76, 0x61,
             0x6E, 0x63, 0x65, 0x64, 0x20, 0x45, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x74, 0x61, 0x6E,
             0x64, 0x61, 0x72, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x32, 0x35, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6B, 0x65,
-            0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x0A, 0x0A,
+            0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x0A,
+            0x2A, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x67, 0x63, 0x6D, 0x20, 0x2D, 0x20, 0x41, 0x64, 0x76, 0x61,
+            0x6E, 0x63, 0x65, 0x64, 0x20, 0x45, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x74, 0x61, 0x6E,
+            0x64, 0x61, 0x72, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x32, 0x35, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6B, 0x65,
+            0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x47, 0x61, 0x6C, 0x6F, 0x69, 0x73, 0x2F, 0x43,
+            0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63,
+            0x68, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x75,
+            0x74, 0x68, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x0A, 0x0A,
             0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E,
             0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64,
             0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66,
@@ -3274,7 +3502,7 @@ static const unsigned char helpDataPack[] =
                 pckTypeStr << 4 | 0x09, 0x15, // Summary
                     0x42, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x74, 0x61,
                     0x69, 0x6C, 0x2E,
-                pckTypeStr << 4 | 0x08, 0x92, 0x02, // Description
+                pckTypeStr << 4 | 0x08, 0xE5, 0x03, // Description
                     0x44, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x61, 0x20,
                     0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x20,
                     0x28, 0x77, 0x69, 0x74, 0x68, 0x20, 0x4F, 0x49, 0x44, 0x73, 0x29, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
@@ -3290,7 +3518,19 @@ static const unsigned char helpDataPack[] =
                     0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
                     0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x2D, 0x2D,
                     0x6C, 0x69, 0x6E, 0x6B, 0x2D, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66,
-                    0x69, 0x65, 0x64, 0x2E,
+                    0x69, 0x65, 0x64, 0x2E, 0x0A, 0x0A,
+                    0x54, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+                    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+                    0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B,
+                    0x75, 0x70, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+                    0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+                    0x68, 0x69, 0x73, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+                    0x74, 0x61, 0x6E, 0x7A, 0x61, 0x2C, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x62,
+                    0x79, 0x74, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x2C, 0x20, 0x72, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x65,
+                    0x73, 0x74, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x61,
+                    0x69, 0x6E, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+                    0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x69, 0x73, 0x20,
+                    0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x2E,
             0x00, // Command info override end
 
             pckTypeObj << 4 | 0x05, // Command restore override begin
@@ -3511,6 +3751,43 @@ static const unsigned char helpDataPack[] =
             0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x28, 0x29, 0x20, 0x73, 0x6F, 0x20, 0x61,
             0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2E,
 
+        // sync-defer option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+        pckTypeStr << 4 | 0x08, 0x31, // Summary
+            0x53, 0x79, 0x6E, 0x63, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20,
+            0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x83, 0x04, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x73, 0x74,
+            0x6F, 0x72, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20,
+            0x61, 0x73, 0x20, 0x73, 0x6F, 0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x77, 0x72, 0x69,
+            0x74, 0x74, 0x65, 0x6E, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x77, 0x69,
+            0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x61, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69,
+            0x74, 0x74, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70,
+            0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65,
+            0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65,
+            0x6E, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76,
+            0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74,
+            0x69, 0x6D, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x74,
+            0x6F, 0x72, 0x65, 0x64, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x6D, 0x61, 0x6B, 0x65,
+            0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x73,
+            0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x73, 0x79, 0x6E,
+            0x63, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x2E, 0x0A, 0x0A,
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66,
+            0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
+            0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x65,
+            0x66, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x67, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x70,
+            0x75, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x69,
+            0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x73,
+            0x74, 0x69, 0x6C, 0x6C, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+            0x65, 0x64, 0x2E,
+
         // tablespace-map option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
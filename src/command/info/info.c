@@ -10,6 +10,7 @@ Info Command
 
 #include "command/archive/common.h"
 #include "command/info/info.h"
+#include "command/progress.h"
 #include "common/debug.h"
 #include "common/io/fdWrite.h"
 #include "common/lock.h"
@@ -93,6 +94,9 @@ STRING_STATIC(INFO_STANZA_STATUS_MESSAGE_PG_MISMATCH_STR,           "database mi
 
 #define INFO_STANZA_STATUS_MESSAGE_LOCK_BACKUP                      "backup/expire running"
 
+// Special value for the set option to show the progress of a running backup or restore
+#define INFO_SET_CURRENT                                            "current"
+
 /***********************************************************************************************************************************
 Data types and structures
 ***********************************************************************************************************************************/
@@ -406,8 +410,8 @@ backupListAdd(
     // If a backup label was specified and this is that label, then get the manifest
     if (backupLabel != NULL && strEq(backupData->backupLabel, backupLabel))
     {
-        // Load the manifest file
-        Manifest *manifest = manifestLoadFile(
+        // Load the manifest file summary since only files with page checksum errors are reported
+        Manifest *manifest = manifestLoadFileSummary(
             storageRepoIdx(repoIdx), strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE, strZ(backupLabel)),
             repoData->cipher, infoPgCipherPass(infoBackupPg(repoData->backupInfo)));
 
@@ -1125,6 +1129,117 @@ infoUpdateStanza(const Storage *storage, InfoStanzaRepo *stanzaRepo, unsigned in
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Format a duration in seconds, e.g. 1h02m03s
+***********************************************************************************************************************************/
+static String *
+infoDurationFormat(uint64_t duration)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, duration);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(
+        strNewFmt(
+            "%" PRIu64 "h%02um%02us", duration / 3600, (unsigned int)(duration % 3600 / 60), (unsigned int)(duration % 60)));
+}
+
+/***********************************************************************************************************************************
+Render the progress of a running backup or restore from the status files in the lock path (--set=current)
+***********************************************************************************************************************************/
+static String *
+infoRenderProgress(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    String *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *stanza = cfgOptionStr(cfgOptStanza);
+        const bool outputText = strEq(cfgOptionStr(cfgOptOutput), CFGOPTVAL_INFO_OUTPUT_TEXT_STR);
+        String *resultStr = strNewFmt("stanza: %s\n", strZ(stanza));
+        VariantList *statusList = varLstNew();
+
+        // Check for a running backup and then a running restore
+        const char *const commandList[] = {CFGCMD_BACKUP, CFGCMD_RESTORE};
+
+        for (unsigned int commandIdx = 0; commandIdx < sizeof(commandList) / sizeof(commandList[0]); commandIdx++)
+        {
+            KeyValue *status = progressLoad(stanza, STR(commandList[commandIdx]));
+
+            if (status == NULL)
+                continue;
+
+            varLstAdd(statusList, varNewKv(status));
+
+            // The status file is output as-is for json so no formatting is required
+            if (!outputText)
+                continue;
+
+            // Command and timestamps
+            char timeBufferStart[20];
+            char timeBufferUpdate[20];
+            time_t timeStart = (time_t)varUInt64Force(kvGet(status, PROGRESS_KEY_TIMESTAMP_START_VAR));
+            time_t timeUpdate = (time_t)varUInt64Force(kvGet(status, PROGRESS_KEY_TIMESTAMP_UPDATE_VAR));
+
+            strftime(timeBufferStart, sizeof(timeBufferStart), "%Y-%m-%d %H:%M:%S", localtime(&timeStart));
+            strftime(timeBufferUpdate, sizeof(timeBufferUpdate), "%Y-%m-%d %H:%M:%S", localtime(&timeUpdate));
+
+            strCatFmt(
+                resultStr, "    status: %s running (pid %d)\n", commandList[commandIdx],
+                varIntForce(kvGet(status, PROGRESS_KEY_PID_VAR)));
+            strCatFmt(resultStr, "        timestamp start/update: %s / %s\n", timeBufferStart, timeBufferUpdate);
+
+            // Size, rate, and estimated time remaining
+            uint64_t sizeTotal = varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_TOTAL_VAR));
+            uint64_t sizeDone = varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_DONE_VAR));
+            const Variant *eta = kvGet(status, PROGRESS_KEY_ETA_VAR);
+
+            strCatFmt(
+                resultStr, "        progress: %s of %s (%.2f%%)\n", strZ(strSizeFormat(sizeDone)), strZ(strSizeFormat(sizeTotal)),
+                sizeTotal == 0 ? 100.0 : (double)sizeDone * 100.0 / (double)sizeTotal);
+            strCatFmt(
+                resultStr, "        rate: %s/s, remaining: %s\n",
+                strZ(strSizeFormat(varUInt64Force(kvGet(status, PROGRESS_KEY_RATE_VAR)))),
+                eta == NULL ? "unknown" : strZ(infoDurationFormat(varUInt64Force(eta))));
+
+            // Worker state
+            const VariantList *workerList = kvGetList(status, PROGRESS_KEY_WORKER_VAR);
+
+            for (unsigned int workerIdx = 0; workerIdx < varLstSize(workerList); workerIdx++)
+            {
+                const KeyValue *worker = varKv(varLstGet(workerList, workerIdx));
+                const Variant *file = kvGet(worker, PROGRESS_KEY_FILE_VAR);
+
+                if (file == NULL)
+                    strCatFmt(resultStr, "        worker %u: idle\n", workerIdx + 1);
+                else
+                {
+                    strCatFmt(
+                        resultStr, "        worker %u: %s (%s)\n", workerIdx + 1, strZ(varStr(file)),
+                        strZ(infoDurationFormat(varUInt64Force(kvGet(worker, PROGRESS_KEY_TIME_VAR)))));
+                }
+            }
+        }
+
+        // Output the list of status files for json
+        if (!outputText)
+            resultStr = jsonFromVar(varNewVarLst(statusList));
+        else if (varLstEmpty(statusList))
+            strCatZ(resultStr, "    status: no backup or restore running\n");
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = strDup(resultStr);
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
+
 /***********************************************************************************************************************************
 Render the information for the stanza based on the command parameters
 ***********************************************************************************************************************************/
@@ -1133,6 +1248,10 @@ infoRender(void)
 {
     FUNCTION_LOG_VOID(logLevelDebug);
 
+    // Render the progress of a running backup or restore instead of the repository info when requested
+    if (cfgOptionTest(cfgOptSet) && strEqZ(cfgOptionStr(cfgOptSet), INFO_SET_CURRENT))
+        FUNCTION_LOG_RETURN(STRING, infoRenderProgress());
+
     String *result = NULL;
 
     MEM_CONTEXT_TEMP_BEGIN()
@@ -6,6 +6,7 @@ Local Command
 #include "command/archive/get/protocol.h"
 #include "command/archive/push/protocol.h"
 #include "command/backup/protocol.h"
+#include "command/expire/protocol.h"
 #include "command/restore/protocol.h"
 #include "command/verify/protocol.h"
 #include "common/debug.h"
@@ -35,6 +36,7 @@ cmdLocal(int fdRead, int fdWrite)
         protocolServerHandlerAdd(server, archiveGetProtocol);
         protocolServerHandlerAdd(server, archivePushProtocol);
         protocolServerHandlerAdd(server, backupProtocol);
+        protocolServerHandlerAdd(server, expireProtocol);
         protocolServerHandlerAdd(server, restoreProtocol);
         protocolServerHandlerAdd(server, verifyProtocol);
         protocolServerProcess(server, cfgCommandJobRetry());
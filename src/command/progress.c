@@ -0,0 +1,293 @@
+/***********************************************************************************************************************************
+Progress Reporting
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "command/progress.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/time.h"
+#include "common/type/json.h"
+#include "common/type/object.h"
+#include "config/config.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Status file keys
+***********************************************************************************************************************************/
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_COMMAND_VAR,                     PROGRESS_KEY_COMMAND);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_ETA_VAR,                         PROGRESS_KEY_ETA);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_FILE_VAR,                        PROGRESS_KEY_FILE);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_PID_VAR,                         PROGRESS_KEY_PID);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_RATE_VAR,                        PROGRESS_KEY_RATE);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_SIZE_DONE_VAR,                   PROGRESS_KEY_SIZE_DONE);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_SIZE_TOTAL_VAR,                  PROGRESS_KEY_SIZE_TOTAL);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_TIME_VAR,                        PROGRESS_KEY_TIME);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_TIMESTAMP_START_VAR,             PROGRESS_KEY_TIMESTAMP_START);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_TIMESTAMP_UPDATE_VAR,            PROGRESS_KEY_TIMESTAMP_UPDATE);
+VARIANT_STRDEF_EXTERN(PROGRESS_KEY_WORKER_VAR,                      PROGRESS_KEY_WORKER);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct ProgressWorker
+{
+    const String *file;                                             // File being processed (NULL when idle)
+    TimeMSec timeBegin;                                             // When processing of the file began
+} ProgressWorker;
+
+struct Progress
+{
+    MemContext *memContext;                                         // Mem context
+    const String *file;                                             // Status file
+    uint64_t sizeTotal;                                             // Total bytes to process
+    uint64_t sizeDone;                                              // Bytes processed so far
+    TimeMSec timeBegin;                                             // When processing began
+    TimeMSec timeSave;                                              // When the status file was last written
+    bool saveError;                                                 // Did the last status file write fail?
+    unsigned int workerTotal;                                       // Total workers
+    ProgressWorker *workerList;                                     // Worker state
+};
+
+OBJECT_DEFINE_FREE(PROGRESS);
+
+/***********************************************************************************************************************************
+Get the status file name for a command on a stanza
+***********************************************************************************************************************************/
+static String *
+progressFileName(const String *stanza, const String *command)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, stanza);
+        FUNCTION_TEST_PARAM(STRING, command);
+    FUNCTION_TEST_END();
+
+    ASSERT(stanza != NULL);
+    ASSERT(command != NULL);
+
+    FUNCTION_TEST_RETURN(
+        strNewFmt("%s/%s-%s" PROGRESS_FILE_EXT, strZ(cfgOptionStr(cfgOptLockPath)), strZ(stanza), strZ(command)));
+}
+
+/***********************************************************************************************************************************
+Write the status file
+***********************************************************************************************************************************/
+static void
+progressSave(Progress *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROGRESS, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TimeMSec timeNow = timeMSec();
+        KeyValue *status = kvNew();
+
+        kvPut(status, PROGRESS_KEY_COMMAND_VAR, VARSTRZ(cfgCommandName(cfgCommand())));
+        kvPut(status, PROGRESS_KEY_PID_VAR, VARINT(getpid()));
+        kvPut(status, PROGRESS_KEY_TIMESTAMP_START_VAR, VARUINT64(this->timeBegin / MSEC_PER_SEC));
+        kvPut(status, PROGRESS_KEY_TIMESTAMP_UPDATE_VAR, VARUINT64(timeNow / MSEC_PER_SEC));
+        kvPut(status, PROGRESS_KEY_SIZE_TOTAL_VAR, VARUINT64(this->sizeTotal));
+        kvPut(status, PROGRESS_KEY_SIZE_DONE_VAR, VARUINT64(this->sizeDone));
+
+        // Calculate the rate in bytes per second and the estimated seconds remaining. The estimate is omitted until there is enough
+        // data to calculate it.
+        TimeMSec timeElapsed = timeNow > this->timeBegin ? timeNow - this->timeBegin : 0;
+        uint64_t rate = timeElapsed == 0 ? 0 : this->sizeDone * MSEC_PER_SEC / timeElapsed;
+
+        kvPut(status, PROGRESS_KEY_RATE_VAR, VARUINT64(rate));
+
+        if (rate > 0)
+            kvPut(status, PROGRESS_KEY_ETA_VAR, VARUINT64((this->sizeTotal - this->sizeDone) / rate));
+
+        // Add the state of each worker
+        VariantList *workerList = varLstNew();
+
+        for (unsigned int workerIdx = 0; workerIdx < this->workerTotal; workerIdx++)
+        {
+            const ProgressWorker *worker = &this->workerList[workerIdx];
+            KeyValue *workerKv = kvNew();
+
+            kvPut(workerKv, PROGRESS_KEY_FILE_VAR, worker->file == NULL ? NULL : VARSTR(worker->file));
+
+            if (worker->file != NULL)
+            {
+                kvPut(
+                    workerKv, PROGRESS_KEY_TIME_VAR,
+                    VARUINT64(timeNow > worker->timeBegin ? (timeNow - worker->timeBegin) / MSEC_PER_SEC : 0));
+            }
+
+            varLstAdd(workerList, varNewKv(workerKv));
+        }
+
+        kvPut(status, PROGRESS_KEY_WORKER_VAR, varNewVarLst(workerList));
+
+        // Write atomically so a reader never sees a partial file. The file is informational so skip the syncs and do not fail the
+        // command when it cannot be written. Warn only on the first failure in a row to avoid repeating the warning every interval.
+        TRY_BEGIN()
+        {
+            storagePutP(
+                storageNewWriteP(storageLocalWrite(), this->file, .noSyncFile = true, .noSyncPath = true),
+                BUFSTR(jsonFromKv(status)));
+
+            this->saveError = false;
+        }
+        CATCH_ANY()
+        {
+            if (!this->saveError)
+            {
+                LOG_WARN_FMT(
+                    "unable to write progress status file '%s': [%s] %s", strZ(this->file), errorTypeName(errorType()),
+                    errorMessage());
+            }
+
+            this->saveError = true;
+        }
+        TRY_END();
+
+        this->timeSave = timeNow;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Remove the status file when the object is freed
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(PROGRESS, LOG, logLevelTrace)
+{
+    storageRemoveP(storageLocalWrite(), this->file);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/**********************************************************************************************************************************/
+Progress *
+progressNew(uint64_t sizeTotal, unsigned int workerTotal)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT64, sizeTotal);
+        FUNCTION_LOG_PARAM(UINT, workerTotal);
+    FUNCTION_LOG_END();
+
+    ASSERT(workerTotal > 0);
+
+    Progress *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("Progress")
+    {
+        this = memNew(sizeof(Progress));
+
+        *this = (Progress)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .file = progressFileName(cfgOptionStr(cfgOptStanza), STR(cfgCommandName(cfgCommand()))),
+            .sizeTotal = sizeTotal,
+            .timeBegin = timeMSec(),
+            .workerTotal = workerTotal,
+            .workerList = memNew(workerTotal * sizeof(ProgressWorker)),
+        };
+
+        for (unsigned int workerIdx = 0; workerIdx < workerTotal; workerIdx++)
+            this->workerList[workerIdx] = (ProgressWorker){.file = NULL};
+
+        progressSave(this);
+        memContextCallbackSet(this->memContext, progressFreeResource, this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(PROGRESS, this);
+}
+
+/**********************************************************************************************************************************/
+void
+progressWorkerSet(Progress *this, unsigned int workerIdx, const String *file)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROGRESS, this);
+        FUNCTION_LOG_PARAM(UINT, workerIdx);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(workerIdx < this->workerTotal);
+
+    ProgressWorker *worker = &this->workerList[workerIdx];
+
+    strFree((String *)worker->file);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        worker->file = strDup(file);
+    }
+    MEM_CONTEXT_END();
+
+    worker->timeBegin = timeMSec();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+progressUpdate(Progress *this, uint64_t sizeDone)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROGRESS, this);
+        FUNCTION_LOG_PARAM(UINT64, sizeDone);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Files that grow while being copied can push bytes done past the total calculated at the start, so clamp to the total
+    this->sizeDone = sizeDone > this->sizeTotal ? this->sizeTotal : sizeDone;
+
+    if (timeMSec() - this->timeSave >= PROGRESS_SAVE_INTERVAL_MSEC)
+        progressSave(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+KeyValue *
+progressLoad(const String *stanza, const String *command)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, stanza);
+        FUNCTION_LOG_PARAM(STRING, command);
+    FUNCTION_LOG_END();
+
+    ASSERT(stanza != NULL);
+    ASSERT(command != NULL);
+
+    KeyValue *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Buffer *status = storageGetP(
+            storageNewReadP(storageLocal(), progressFileName(stanza, command), .ignoreMissing = true));
+
+        if (status != NULL)
+        {
+            KeyValue *statusKv = jsonToKv(strNewBuf(status));
+
+            // Ignore the file if the process that wrote it is gone, e.g. it was killed before it could remove the file. A pid <= 0
+            // is never valid and would signal a process group instead.
+            pid_t pid = (pid_t)varIntForce(kvGet(statusKv, PROGRESS_KEY_PID_VAR));
+
+            if (pid > 0 && (kill(pid, 0) == 0 || errno == EPERM))
+                result = kvMove(statusKv, memContextPrior());
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(KEY_VALUE, result);
+}
@@ -0,0 +1,89 @@
+/***********************************************************************************************************************************
+Progress Reporting
+
+Long-running commands (e.g. backup and restore) periodically write their progress to a status file in the lock path so it can be
+monitored while the command is running, e.g. with info --set=current. The status file contains the bytes done, rate, estimated time
+remaining, and the file each worker process is currently processing. The status file is removed when the Progress object is freed,
+whether the command completes successfully or not.
+***********************************************************************************************************************************/
+#ifndef COMMAND_PROGRESS_H
+#define COMMAND_PROGRESS_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define PROGRESS_TYPE                                               Progress
+#define PROGRESS_PREFIX                                             progress
+
+typedef struct Progress Progress;
+
+#include "common/type/keyValue.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+#define PROGRESS_FILE_EXT                                           ".progress"
+
+// Minimum time between status file updates
+#define PROGRESS_SAVE_INTERVAL_MSEC                                 5000
+
+/***********************************************************************************************************************************
+Status file keys
+***********************************************************************************************************************************/
+#define PROGRESS_KEY_COMMAND                                        "command"
+    VARIANT_DECLARE(PROGRESS_KEY_COMMAND_VAR);
+#define PROGRESS_KEY_ETA                                            "eta"
+    VARIANT_DECLARE(PROGRESS_KEY_ETA_VAR);
+#define PROGRESS_KEY_FILE                                           "file"
+    VARIANT_DECLARE(PROGRESS_KEY_FILE_VAR);
+#define PROGRESS_KEY_PID                                            "pid"
+    VARIANT_DECLARE(PROGRESS_KEY_PID_VAR);
+#define PROGRESS_KEY_RATE                                           "rate"
+    VARIANT_DECLARE(PROGRESS_KEY_RATE_VAR);
+#define PROGRESS_KEY_SIZE_DONE                                      "size-done"
+    VARIANT_DECLARE(PROGRESS_KEY_SIZE_DONE_VAR);
+#define PROGRESS_KEY_SIZE_TOTAL                                     "size-total"
+    VARIANT_DECLARE(PROGRESS_KEY_SIZE_TOTAL_VAR);
+#define PROGRESS_KEY_TIME                                           "time"
+    VARIANT_DECLARE(PROGRESS_KEY_TIME_VAR);
+#define PROGRESS_KEY_TIMESTAMP_START                                "timestamp-start"
+    VARIANT_DECLARE(PROGRESS_KEY_TIMESTAMP_START_VAR);
+#define PROGRESS_KEY_TIMESTAMP_UPDATE                               "timestamp-update"
+    VARIANT_DECLARE(PROGRESS_KEY_TIMESTAMP_UPDATE_VAR);
+#define PROGRESS_KEY_WORKER                                         "worker"
+    VARIANT_DECLARE(PROGRESS_KEY_WORKER_VAR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Start tracking progress for the current command and write the initial status file
+Progress *progressNew(uint64_t sizeTotal, unsigned int workerTotal);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Set the file a worker is processing. A NULL file indicates that the worker is idle.
+void progressWorkerSet(Progress *this, unsigned int workerIdx, const String *file);
+
+// Update bytes done, clamped to the total, and write the status file if enough time has passed since the last write
+void progressUpdate(Progress *this, uint64_t sizeDone);
+
+// Load the status file for a command on the specified stanza. NULL is returned when the file is missing or the process that wrote
+// it is no longer running.
+KeyValue *progressLoad(const String *stanza, const String *command);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void progressFree(Progress *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_PROGRESS_TYPE                                                                                                 \
+    Progress *
+#define FUNCTION_LOG_PROGRESS_FORMAT(value, buffer, bufferSize)                                                                    \
+    objToLog(value, "Progress", buffer, bufferSize)
+
+#endif
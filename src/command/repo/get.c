@@ -131,7 +131,7 @@ storageGetProcess(IoWrite *destination)
                                     !strEndsWithZ(file, BACKUP_MANIFEST_FILE) &&
                                     !strEndsWithZ(file, BACKUP_MANIFEST_FILE INFO_COPY_EXT))
                                 {
-                                    const Manifest *manifest = manifestLoadFile(
+                                    const Manifest *manifest = manifestLoadFileSummary(
                                         storageRepo(), strNewFmt(STORAGE_PATH_BACKUP "/%s/%s/%s", strZ(stanza),
                                         strZ(strLstGet(filePathSplitLst, 2)), BACKUP_MANIFEST_FILE), repoCipherType, cipherPass);
                                     cipherPass = manifestCipherSubPass(manifest);
@@ -3,28 +3,148 @@ Restore File
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
-#include <fcntl.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
 #include "command/restore/file.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
+#include "common/crypto/hashBlock.h"
 #include "common/debug.h"
 #include "common/io/filter/group.h"
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
 #include "config/config.h"
+#include "info/manifest.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Set the modification time of a restored file
+***********************************************************************************************************************************/
+static void
+restoreFileTimeSet(const String *pgFile, time_t pgFileModified)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, pgFile);
+        FUNCTION_TEST_PARAM(TIME, pgFileModified);
+    FUNCTION_TEST_END();
+
+    THROW_ON_SYS_ERROR_FMT(
+        utime(
+            strZ(storagePathP(storagePg(), pgFile)),
+            &((struct utimbuf){.actime = pgFileModified, .modtime = pgFileModified})) == -1,
+        FileInfoError, "unable to set time for '%s'", strZ(storagePathP(storagePg(), pgFile)));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Rewrite only the blocks of an existing file where the block checksums stored in the repo do not match the block checksums of the
+existing file. The file must already be the expected size so the blocks line up. Each run of adjacent blocks that differ is written
+in place with a single write that does not truncate the file.
+***********************************************************************************************************************************/
+static void
+restoreFileBlockWrite(
+    IoRead *repoRead, const String *pgFile, const String *pgFileChecksum, const Buffer *repoBlockChecksum,
+    const String *pgBlockChecksum, unsigned int blockSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, repoRead);
+        FUNCTION_LOG_PARAM(STRING, pgFile);
+        FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
+        FUNCTION_LOG_PARAM(BUFFER, repoBlockChecksum);
+        FUNCTION_LOG_PARAM(STRING, pgBlockChecksum);
+        FUNCTION_LOG_PARAM(UINT, blockSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(repoRead != NULL);
+    ASSERT(pgFile != NULL);
+    ASSERT(pgFileChecksum != NULL);
+    ASSERT(repoBlockChecksum != NULL);
+    ASSERT(pgBlockChecksum != NULL);
+    ASSERT(bufUsed(repoBlockChecksum) == strSize(pgBlockChecksum));
+    ASSERT(blockSize > 0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Add sha1 filter to validate the file as it is read from the repo
+        ioFilterGroupAdd(ioReadFilterGroup(repoRead), cryptoHashNew(HASH_TYPE_SHA1_STR));
+        ioReadOpen(repoRead);
+
+        Buffer *block = bufNew(blockSize);
+        StorageWrite *pgFileWrite = NULL;
+        unsigned int blockIdx = 0;
+
+        do
+        {
+            ioRead(repoRead, block);
+
+            if (bufUsed(block) > 0)
+            {
+                // Write the block only when its checksum differs from the checksum of the same block in the existing file. Blocks
+                // past the end of the checksum list are written so the checksum validation below reports the error.
+                const size_t blockChecksumOffset = blockIdx * HASH_TYPE_SHA1_SIZE_HEX;
+
+                if (blockChecksumOffset >= bufUsed(repoBlockChecksum) ||
+                    memcmp(
+                        bufPtrConst(repoBlockChecksum) + blockChecksumOffset, strZ(pgBlockChecksum) + blockChecksumOffset,
+                        HASH_TYPE_SHA1_SIZE_HEX) != 0)
+                {
+                    // Start a write at this block if the prior block was not written
+                    if (pgFileWrite == NULL)
+                    {
+                        pgFileWrite = storageNewWriteP(
+                            storagePgWrite(), pgFile, .noAtomic = true, .noCreatePath = true, .noSyncFile = true,
+                            .noSyncPath = true, .writeBehind = true, .noTruncate = true, .offset = (uint64_t)blockIdx * blockSize);
+                        ioWriteOpen(storageWriteIo(pgFileWrite));
+                    }
+
+                    ioWrite(storageWriteIo(pgFileWrite), block);
+                }
+                // Else finish the write of the prior blocks
+                else if (pgFileWrite != NULL)
+                {
+                    ioWriteClose(storageWriteIo(pgFileWrite));
+                    storageWriteFree(pgFileWrite);
+                    pgFileWrite = NULL;
+                }
+
+                blockIdx++;
+            }
+
+            bufUsedZero(block);
+        }
+        while (!ioReadEof(repoRead));
+
+        if (pgFileWrite != NULL)
+            ioWriteClose(storageWriteIo(pgFileWrite));
+
+        ioReadClose(repoRead);
+
+        // Validate checksum
+        const String *checksum = varStr(ioFilterGroupResult(ioReadFilterGroup(repoRead), CRYPTO_HASH_FILTER_TYPE_STR));
+
+        if (!strEq(pgFileChecksum, checksum))
+        {
+            THROW_FMT(
+                ChecksumError, "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strZ(pgFile),
+                strZ(checksum), strZ(pgFileChecksum));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 bool
 restoreFile(
     const String *repoFile, unsigned int repoIdx, const String *repoFileReference, CompressType repoFileCompressType,
-    const String *pgFile, const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified,
-    mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
-    const String *cipherPass)
+    const String *pgFile, const String *pgFileChecksum, unsigned int pgFileChecksumBlockSize, bool pgFileZero, uint64_t pgFileSize,
+    time_t pgFileModified, mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta,
+    bool deltaForce, const String *cipherPass, bool repoDecode, bool pgFileSync)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, repoFile);
@@ -33,6 +153,7 @@ restoreFile(
         FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
         FUNCTION_LOG_PARAM(STRING, pgFile);
         FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
+        FUNCTION_LOG_PARAM(UINT, pgFileChecksumBlockSize);
         FUNCTION_LOG_PARAM(BOOL, pgFileZero);
         FUNCTION_LOG_PARAM(UINT64, pgFileSize);
         FUNCTION_LOG_PARAM(TIME, pgFileModified);
@@ -43,6 +164,8 @@ restoreFile(
         FUNCTION_LOG_PARAM(BOOL, delta);
         FUNCTION_LOG_PARAM(BOOL, deltaForce);
         FUNCTION_TEST_PARAM(STRING, cipherPass);
+        FUNCTION_LOG_PARAM(BOOL, repoDecode);
+        FUNCTION_LOG_PARAM(BOOL, pgFileSync);
     FUNCTION_LOG_END();
 
     ASSERT(repoFile != NULL);
@@ -52,11 +175,11 @@ restoreFile(
     // Was the file copied?
     bool result = true;
 
-    // Is the file compressible during the copy?
-    bool compressible = true;
-
     MEM_CONTEXT_TEMP_BEGIN()
     {
+        // Block checksums of the existing file, when the backup stored block checksums and the existing file can be block copied
+        const String *pgBlockChecksum = NULL;
+
         // Perform delta if requested.  Delta zero-length files to avoid overwriting the file if the timestamp is correct.
         if (delta && !pgFileZero)
         {
@@ -78,13 +201,18 @@ restoreFile(
                     // Only continue delta if the file size is as expected
                     if (info.size == pgFileSize)
                     {
-                        // Generate checksum for the file if size is not zero
+                        // Generate checksum for the file if size is not zero. Block checksums are generated in the same pass
+                        // so they are available if the file does not match.
                         IoRead *read = NULL;
 
                         if (info.size != 0)
                         {
                             read = storageReadIo(storageNewReadP(storagePgWrite(), pgFile));
                             ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+                            if (pgFileChecksumBlockSize != 0)
+                                ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashBlockNew(pgFileChecksumBlockSize));
+
                             ioReadDrain(read);
                         }
 
@@ -96,28 +224,102 @@ restoreFile(
                             // Even if hash/size are the same set the time back to backup time.  This helps with unit testing, but
                             // also presents a pristine version of the database after restore.
                             if (info.timeModified != pgFileModified)
-                            {
-                                THROW_ON_SYS_ERROR_FMT(
-                                    utime(
-                                        strZ(storagePathP(storagePg(), pgFile)),
-                                        &((struct utimbuf){.actime = pgFileModified, .modtime = pgFileModified})) == -1,
-                                    FileInfoError, "unable to set time for '%s'", strZ(storagePathP(storagePg(), pgFile)));
-                            }
+                                restoreFileTimeSet(pgFile, pgFileModified);
 
                             result = false;
                         }
+                        else if (pgFileChecksumBlockSize != 0)
+                        {
+                            pgBlockChecksum = varStr(
+                                ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_BLOCK_FILTER_TYPE_STR));
+                        }
                     }
                 }
+
+                // If force did not match but the file is the expected size then generate block checksums so only changed blocks
+                // need to be written
+                if (result && deltaForce && pgFileChecksumBlockSize != 0 && info.size == pgFileSize && info.size != 0)
+                {
+                    IoRead *read = storageReadIo(storageNewReadP(storagePgWrite(), pgFile));
+                    ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashBlockNew(pgFileChecksumBlockSize));
+                    ioReadDrain(read);
+
+                    pgBlockChecksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_BLOCK_FILTER_TYPE_STR));
+                }
+            }
+        }
+
+        // If block checksums are available for the existing file then compare them to the block checksums stored in the repo
+        bool blockCopy = false;
+
+        if (pgBlockChecksum != NULL)
+        {
+            StorageRead *blockRead = storageNewReadP(
+                storageRepoIdx(repoIdx),
+                strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(repoFileReference), strZ(repoFile)),
+                .ignoreMissing = true);
+
+            if (cipherPass != NULL)
+            {
+                ioFilterGroupAdd(
+                    ioReadFilterGroup(storageReadIo(blockRead)),
+                    cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+            }
+
+            const Buffer *repoBlockChecksum = storageGetP(blockRead);
+
+            // If the block checksums are missing or do not line up with the existing file then fall back to a full copy
+            if (repoBlockChecksum != NULL && bufUsed(repoBlockChecksum) == strSize(pgBlockChecksum))
+            {
+                // All blocks match so the file only differs in time (force delta). Set the time and report the file as not copied.
+                if (bufEq(repoBlockChecksum, BUFSTR(pgBlockChecksum)))
+                {
+                    restoreFileTimeSet(pgFile, pgFileModified);
+                    result = false;
+                }
+                // Else rewrite the blocks that differ
+                else
+                {
+                    IoRead *repoRead = storageReadIo(
+                        storageNewReadP(
+                            storageRepoIdx(repoIdx),
+                            strNewFmt(
+                                STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
+                                strZ(compressExtStr(repoFileCompressType))),
+                            .compressible = cipherPass == NULL && repoFileCompressType == compressTypeNone));
+
+                    if (cipherPass != NULL)
+                    {
+                        ioFilterGroupAdd(
+                            ioReadFilterGroup(repoRead),
+                            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+                    }
+
+                    if (repoFileCompressType != compressTypeNone)
+                        ioFilterGroupAdd(ioReadFilterGroup(repoRead), decompressFilter(repoFileCompressType));
+
+                    restoreFileBlockWrite(
+                        repoRead, pgFile, pgFileChecksum, repoBlockChecksum, pgBlockChecksum, pgFileChecksumBlockSize);
+                    restoreFileTimeSet(pgFile, pgFileModified);
+
+                    if (pgFileSync)
+                        storageFileSyncP(storagePgWrite(), pgFile);
+
+                    blockCopy = true;
+                }
             }
         }
 
         // Copy file from repository to database or create zero-length/sparse file
-        if (result)
+        if (result && !blockCopy)
         {
-            // Create destination file
+            // Create destination file. Copied files are written sparse so zero blocks, e.g. in preallocated WAL or relations that
+            // were extended but never written, do not need to be written or allocated on disk. They are also written behind since
+            // restore does not read them again.
             StorageWrite *pgFileWrite = storageNewWriteP(
                 storagePgWrite(), pgFile, .modeFile = pgFileMode, .user = pgFileUser, .group = pgFileGroup,
-                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncPath = true);
+                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncFile = !pgFileSync,
+                .noSyncPath = true, .sparse = pgFileSize != 0 && !pgFileZero, .writeBehind = true);
 
             // If size is zero/sparse no need to actually copy
             if (pgFileSize == 0 || pgFileZero)
@@ -142,19 +344,31 @@ restoreFile(
             {
                 IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(pgFileWrite));
 
+                // The file is compressible during the copy only if it is not already compressed or encrypted. When decoding on the
+                // repo host the decoded file is sent uncompressed since the goal is to save CPU on the pg host.
+                const bool compressible = cipherPass == NULL && repoFileCompressType == compressTypeNone;
+
+                StorageRead *repoFileRead = storageNewReadP(
+                    storageRepoIdx(repoIdx),
+                    strNewFmt(
+                        STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
+                        strZ(compressExtStr(repoFileCompressType))),
+                    .compressible = compressible);
+
+                // Decode on the repo host if requested. Read filters run on the repo host when the repo is remote, so the pg host
+                // only receives the decoded file. Otherwise decode on the pg host after transfer.
+                IoFilterGroup *decodeFilterGroup = repoDecode ? ioReadFilterGroup(storageReadIo(repoFileRead)) : filterGroup;
+
                 // Add decryption filter
                 if (cipherPass != NULL)
                 {
-                    ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
-                    compressible = false;
+                    ioFilterGroupAdd(
+                        decodeFilterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
                 }
 
                 // Add decompression filter
                 if (repoFileCompressType != compressTypeNone)
-                {
-                    ioFilterGroupAdd(filterGroup, decompressFilter(repoFileCompressType));
-                    compressible = false;
-                }
+                    ioFilterGroupAdd(decodeFilterGroup, decompressFilter(repoFileCompressType));
 
                 // Add sha1 filter
                 ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
@@ -163,14 +377,7 @@ restoreFile(
                 ioFilterGroupAdd(filterGroup, ioSizeNew());
 
                 // Copy file
-                storageCopyP(
-                    storageNewReadP(
-                        storageRepoIdx(repoIdx),
-                        strNewFmt(
-                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
-                            strZ(compressExtStr(repoFileCompressType))),
-                        .compressible = compressible),
-                    pgFileWrite);
+                storageCopyP(repoFileRead, pgFileWrite);
 
                 // Validate checksum
                 if (!strEq(pgFileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
@@ -187,3 +394,19 @@ restoreFile(
 
     FUNCTION_LOG_RETURN(BOOL, result);
 }
+
+/**********************************************************************************************************************************/
+void
+restoreFileSync(const StringList *pgFileList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, pgFileList);
+    FUNCTION_LOG_END();
+
+    ASSERT(pgFileList != NULL);
+
+    for (unsigned int pgFileIdx = 0; pgFileIdx < strLstSize(pgFileList); pgFileIdx++)
+        storageFileSyncP(storagePgWrite(), strLstGet(pgFileList, pgFileIdx));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
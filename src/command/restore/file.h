@@ -7,6 +7,7 @@ Restore File
 #include "common/compress/helper.h"
 #include "common/crypto/common.h"
 #include "common/type/string.h"
+#include "common/type/stringList.h"
 #include "storage/storage.h"
 
 /***********************************************************************************************************************************
@@ -15,8 +16,12 @@ Functions
 // Copy a file from the backup to the specified destination
 bool restoreFile(
     const String *repoFile, unsigned int repoIdx, const String *repoFileReference, CompressType repoFileCompressType,
-    const String *pgFile, const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified,
-    mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
-    const String *cipherPass);
+    const String *pgFile, const String *pgFileChecksum, unsigned int pgFileChecksumBlockSize, bool pgFileZero, uint64_t pgFileSize,
+    time_t pgFileModified, mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta,
+    bool deltaForce, const String *cipherPass, bool repoDecode, bool pgFileSync);
+
+// Sync restored files that were written without a sync (see restoreFile() pgFileSync). Deferring the sync allows the kernel to write
+// back file data in larger batches while other files are still being copied.
+void restoreFileSync(const StringList *pgFileList);
 
 #endif
@@ -16,6 +16,7 @@ Restore Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_FILE_STR,                    PROTOCOL_COMMAND_RESTORE_FILE);
+STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_FILE_SYNC_STR,               PROTOCOL_COMMAND_RESTORE_FILE_SYNC);
 
 /**********************************************************************************************************************************/
 bool
@@ -42,12 +43,19 @@ restoreProtocol(const String *command, const VariantList *paramList, ProtocolSer
                     restoreFile(
                         varStr(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varStr(varLstGet(paramList, 2)),
                         (CompressType)varUIntForce(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)),
-                        varStr(varLstGet(paramList, 5)), varBoolForce(varLstGet(paramList, 6)), varUInt64(varLstGet(paramList, 7)),
-                        (time_t)varInt64Force(varLstGet(paramList, 8)),
-                        (mode_t)cvtZToUIntBase(strZ(varStr(varLstGet(paramList, 9))), 8),
-                        varStr(varLstGet(paramList, 10)), varStr(varLstGet(paramList, 11)),
-                        (time_t)varInt64Force(varLstGet(paramList, 12)), varBoolForce(varLstGet(paramList, 13)),
-                        varBoolForce(varLstGet(paramList, 14)), varStr(varLstGet(paramList, 15)))));
+                        varStr(varLstGet(paramList, 5)), varUIntForce(varLstGet(paramList, 6)),
+                        varBoolForce(varLstGet(paramList, 7)), varUInt64(varLstGet(paramList, 8)),
+                        (time_t)varInt64Force(varLstGet(paramList, 9)),
+                        (mode_t)cvtZToUIntBase(strZ(varStr(varLstGet(paramList, 10))), 8),
+                        varStr(varLstGet(paramList, 11)), varStr(varLstGet(paramList, 12)),
+                        (time_t)varInt64Force(varLstGet(paramList, 13)), varBoolForce(varLstGet(paramList, 14)),
+                        varBoolForce(varLstGet(paramList, 15)), varStr(varLstGet(paramList, 16)),
+                        varBoolForce(varLstGet(paramList, 17)), varBoolForce(varLstGet(paramList, 18)))));
+        }
+        else if (strEq(command, PROTOCOL_COMMAND_RESTORE_FILE_SYNC_STR))
+        {
+            restoreFileSync(strLstNewVarLst(paramList));
+            protocolServerResponse(server, NULL);
         }
         else
             found = false;
@@ -13,6 +13,8 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_RESTORE_FILE                               "restoreFile"
     STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_FILE_STR);
+#define PROTOCOL_COMMAND_RESTORE_FILE_SYNC                          "restoreFileSync"
+    STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_FILE_SYNC_STR);
 
 /***********************************************************************************************************************************
 Functions
@@ -8,12 +8,14 @@ Restore Command
 #include <time.h>
 #include <unistd.h>
 
+#include "command/progress.h"
 #include "command/restore/protocol.h"
 #include "command/restore/restore.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/regExp.h"
+#include "common/stat.h"
 #include "common/user.h"
 #include "config/config.h"
 #include "config/exec.h"
@@ -69,6 +71,8 @@ Recovery constants
     STRING_STATIC(ARCHIVE_MODE_OFF_STR,                             ARCHIVE_MODE_OFF);
 STRING_STATIC(ARCHIVE_MODE_PRESERVE_STR,                            "preserve");
 
+STRING_STATIC(DECODE_HOST_REPO_STR,                                 "repo");
+
 /***********************************************************************************************************************************
 Validate restore path
 ***********************************************************************************************************************************/
@@ -1284,31 +1288,66 @@ restoreSelectiveExpression(Manifest *manifest)
     {
         MEM_CONTEXT_TEMP_BEGIN()
         {
-            // Generate base expression
-            RegExp *baseRegExp = regExpNew(STRDEF("^" MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/[0-9]+/" PG_FILE_PGVERSION));
-
-            // Generate tablespace expression
-            RegExp *tablespaceRegExp = NULL;
+            // Generate the list of paths that contain databases, i.e. base and the version-specific path in each tablespace
             const String *tablespaceId = pgTablespaceId(
                 manifestData(manifest)->pgVersion, manifestData(manifest)->pgCatalogVersion);
+            StringList *dbParentList = strLstNew();
 
-            if (tablespaceId == NULL)
-                tablespaceRegExp = regExpNew(STRDEF("^" MANIFEST_TARGET_PGTBLSPC "/[0-9]+/[0-9]+/" PG_FILE_PGVERSION));
-            else
+            strLstAddZ(dbParentList, MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE);
+
+            for (unsigned int targetIdx = 0; targetIdx < manifestTargetTotal(manifest); targetIdx++)
             {
-                tablespaceRegExp = regExpNew(
-                    strNewFmt("^" MANIFEST_TARGET_PGTBLSPC "/[0-9]+/%s/[0-9]+/" PG_FILE_PGVERSION, strZ(tablespaceId)));
+                const ManifestTarget *target = manifestTarget(manifest, targetIdx);
+
+                if (target->tablespaceId != 0)
+                {
+                    if (tablespaceId == NULL)
+                        strLstAdd(dbParentList, target->name);
+                    else
+                        strLstAdd(dbParentList, strNewFmt("%s/%s", strZ(target->name), strZ(tablespaceId)));
+                }
             }
 
-            // Generate a list of databases in base or in a tablespace
+            // Generate a list of databases in base or in a tablespace. The files in each database path are contiguous in the sorted
+            // file list so the entire range of a database can be skipped once it has been checked.
             StringList *dbList = strLstNew();
 
-            for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(manifest); fileIdx++)
+            for (unsigned int dbParentIdx = 0; dbParentIdx < strLstSize(dbParentList); dbParentIdx++)
             {
-                const ManifestFile *file = manifestFile(manifest, fileIdx);
+                const String *dbParent = strLstGet(dbParentList, dbParentIdx);
+                unsigned int fileIdx;
+                unsigned int fileIdxEnd;
+
+                manifestFileRange(manifest, dbParent, &fileIdx, &fileIdxEnd);
+
+                while (fileIdx < fileIdxEnd)
+                {
+                    const String *fileName = manifestFile(manifest, fileIdx)->name;
+                    const char *dbName = strZ(fileName) + strSize(dbParent) + 1;
+                    const char *dbNameEnd = strchr(dbName, '/');
+
+                    // Skip files that are not in a subpath
+                    if (dbNameEnd == NULL)
+                    {
+                        fileIdx++;
+                        continue;
+                    }
+
+                    // Skip over all the files in the subpath
+                    const String *dbPath = strNewN(strZ(fileName), (size_t)(dbNameEnd - strZ(fileName)));
+                    unsigned int dbFileIdx;
+
+                    manifestFileRange(manifest, dbPath, &dbFileIdx, &fileIdx);
+
+                    // The subpath is a database when the name is an oid and it contains a version file
+                    const size_t dbNameSize = (size_t)(dbNameEnd - dbName);
 
-                if (regExpMatch(baseRegExp, file->name) || regExpMatch(tablespaceRegExp, file->name))
-                    strLstAddIfMissing(dbList, strBase(strPath(file->name)));
+                    if (strspn(dbName, "0123456789") == dbNameSize &&
+                        manifestFileFindDefault(manifest, strNewFmt("%s/" PG_FILE_PGVERSION, strZ(dbPath)), NULL) != NULL)
+                    {
+                        strLstAddIfMissing(dbList, strNewN(dbName, dbNameSize));
+                    }
+                }
             }
 
             strLstSort(dbList, sortOrderAsc);
@@ -1950,12 +1989,15 @@ restoreFilePgPath(const Manifest *manifest, const String *manifestName)
 }
 
 static uint64_t
-restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zeroExp, uint64_t sizeTotal, uint64_t sizeRestored)
+restoreJobResult(
+    const Manifest *manifest, ProtocolParallelJob *job, RegExp *zeroExp, List *syncList, uint64_t sizeTotal,
+    uint64_t sizeRestored)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL_JOB, job);
         FUNCTION_LOG_PARAM(REGEXP, zeroExp);
+        FUNCTION_LOG_PARAM(LIST, syncList);
         FUNCTION_LOG_PARAM(UINT64, sizeTotal);
         FUNCTION_LOG_PARAM(UINT64, sizeRestored);
     FUNCTION_LOG_END();
@@ -1971,6 +2013,11 @@ restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zer
             bool zeroed = restoreFileZeroed(file->name, zeroExp);
             bool copy = varBool(protocolParallelJobResult(job));
 
+            // When sync is deferred files that were written have not been synced yet so queue them for the sync phase. The manifest
+            // name is stored rather than a copy since the manifest outlives the list.
+            if (syncList != NULL && (copy || zeroed))
+                lstAdd(syncList, &file->name);
+
             String *log = strNew("restore");
 
             // Note if file was zeroed (i.e. selective restore)
@@ -2040,6 +2087,8 @@ typedef struct RestoreJobData
     List *queueList;                                                // List of processing queues
     RegExp *zeroExp;                                                // Identify files that should be sparse zeroed
     const String *cipherSubPass;                                    // Passphrase used to decrypt files in the backup
+    List *syncList;                                                 // Restored files that need to be synced (when sync is deferred)
+    Progress *progress;                                             // Progress reporting
 } RestoreJobData;
 
 // Helper to caculate the next queue to scan based on the client index
@@ -2100,9 +2149,12 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
                 protocolCommandParamAdd(
                     command, file->reference != NULL ?
                         VARSTR(file->reference) : VARSTR(manifestData(jobData->manifest)->backupLabel));
-                protocolCommandParamAdd(command, VARUINT(manifestData(jobData->manifest)->backupOptionCompressType));
+                protocolCommandParamAdd(
+                    command,
+                    VARUINT(file->compressSkip ? compressTypeNone : manifestData(jobData->manifest)->backupOptionCompressType));
                 protocolCommandParamAdd(command, VARSTR(restoreFilePgPath(jobData->manifest, file->name)));
                 protocolCommandParamAdd(command, VARSTRZ(file->checksumSha1));
+                protocolCommandParamAdd(command, VARUINT(file->checksumBlockSize));
                 protocolCommandParamAdd(command, VARBOOL(restoreFileZeroed(file->name, jobData->zeroExp)));
                 protocolCommandParamAdd(command, VARUINT64(file->size));
                 protocolCommandParamAdd(command, VARUINT64((uint64_t)file->timestamp));
@@ -2113,6 +2165,8 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
                 protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta)));
                 protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta) && cfgOptionBool(cfgOptForce)));
                 protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
+                protocolCommandParamAdd(command, VARBOOL(strEq(cfgOptionStr(cfgOptDecodeHost), DECODE_HOST_REPO_STR)));
+                protocolCommandParamAdd(command, VARBOOL(jobData->syncList == NULL));
 
                 // Remove job from the queue
                 lstRemoveIdx(queue, 0);
@@ -2120,6 +2174,9 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
                 // Assign job to result
                 result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
 
+                // Report the file this worker is processing
+                progressWorkerSet(jobData->progress, clientIdx, file->name);
+
                 // Break out of the loop early since we found a job
                 break;
             }
@@ -2127,12 +2184,66 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
             queueIdx = restoreJobQueueNext(clientIdx, queueIdx, lstSize(jobData->queueList));
         }
         while (queueIdx != queueEnd);
+
+        // No more jobs for this worker so report it as idle
+        if (result == NULL)
+            progressWorkerSet(jobData->progress, clientIdx, NULL);
     }
     MEM_CONTEXT_TEMP_END();
 
     FUNCTION_TEST_RETURN(result);
 }
 
+/***********************************************************************************************************************************
+Return new sync jobs as requested. Files are synced in batches so the locals can flush many files per request while the kernel
+continues writing back the files queued by other processes.
+***********************************************************************************************************************************/
+#define RESTORE_SYNC_BATCH_SIZE                                     1000
+
+typedef struct RestoreSyncJobData
+{
+    const Manifest *manifest;                                       // Backup manifest
+    const List *syncList;                                           // Restored files that need to be synced
+    unsigned int syncIdx;                                           // Next file to sync
+} RestoreSyncJobData;
+
+static ProtocolParallelJob *restoreSyncJobCallback(void *data, unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    (void)clientIdx;
+
+    ProtocolParallelJob *result = NULL;
+    RestoreSyncJobData *jobData = data;
+
+    if (jobData->syncIdx < lstSize(jobData->syncList))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_FILE_SYNC_STR);
+            const unsigned int syncBegin = jobData->syncIdx;
+
+            do
+            {
+                const String *manifestName = *(const String **)lstGet(jobData->syncList, jobData->syncIdx);
+                protocolCommandParamAdd(command, VARSTR(restoreFilePgPath(jobData->manifest, manifestName)));
+
+                jobData->syncIdx++;
+            }
+            while (jobData->syncIdx < lstSize(jobData->syncList) && jobData->syncIdx - syncBegin < RESTORE_SYNC_BATCH_SIZE);
+
+            result = protocolParallelJobMove(protocolParallelJobNew(VARUINT(syncBegin), command), memContextPrior());
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 void
 cmdRestore(void)
@@ -2154,7 +2265,11 @@ cmdRestore(void)
         RestoreBackupData backupData = restoreBackupSet();
 
         // Load manifest
-        RestoreJobData jobData = {.repoIdx = backupData.repoIdx};
+        RestoreJobData jobData =
+        {
+            .repoIdx = backupData.repoIdx,
+            .syncList = cfgOptionBool(cfgOptSyncDefer) ? lstNewP(sizeof(const String *)) : NULL,
+        };
 
         jobData.manifest = manifestLoadFile(
             storageRepoIdx(backupData.repoIdx),
@@ -2203,7 +2318,11 @@ cmdRestore(void)
         for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
             protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
 
-        // Process jobs
+        // Report progress so the restore can be monitored while it is running
+        jobData.progress = progressNew(sizeTotal, cfgOptionUInt(cfgOptProcessMax));
+
+        // Process jobs. Time spent copying and syncing is recorded so it can be reported in the statistics at command end.
+        TimeUSec phaseBegin = timeUSec();
         uint64_t sizeRestored = 0;
 
         do
@@ -2213,11 +2332,52 @@ cmdRestore(void)
             for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
             {
                 sizeRestored = restoreJobResult(
-                    jobData.manifest, protocolParallelResult(parallelExec), jobData.zeroExp, sizeTotal, sizeRestored);
+                    jobData.manifest, protocolParallelResult(parallelExec), jobData.zeroExp, jobData.syncList, sizeTotal,
+                    sizeRestored);
             }
+
+            // Update progress periodically
+            progressUpdate(jobData.progress, sizeRestored);
         }
         while (!protocolParallelDone(parallelExec));
 
+        // Processing is complete so remove the progress status file
+        progressFree(jobData.progress);
+
+        statBytesAdd(STRDEF("restore.copy"), sizeTotal);
+        phaseBegin = statTimeEnd(STRDEF("restore.copy"), phaseBegin);
+
+        // When sync is deferred, sync restored files in parallel batches. Files are written without a sync so the kernel can write
+        // back data while other files are being copied, but they must be durable before recovery settings and pg_control are
+        // written.
+        if (jobData.syncList != NULL && !lstEmpty(jobData.syncList))
+        {
+            RestoreSyncJobData syncJobData = {.manifest = jobData.manifest, .syncList = jobData.syncList};
+            ProtocolParallel *syncExec = protocolParallelNew(
+                cfgOptionUInt64(cfgOptProtocolTimeout) / 2, restoreSyncJobCallback, &syncJobData);
+
+            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                protocolParallelClientAdd(syncExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
+
+            do
+            {
+                unsigned int completed = protocolParallelProcess(syncExec);
+
+                for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                {
+                    ProtocolParallelJob *job = protocolParallelResult(syncExec);
+
+                    if (protocolParallelJobErrorCode(job) != 0)
+                        THROW_CODE(protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
+
+                    protocolParallelJobFree(job);
+                }
+            }
+            while (!protocolParallelDone(syncExec));
+
+            statTimeEnd(STRDEF("restore.sync"), phaseBegin);
+        }
+
         // Write recovery settings
         restoreRecoveryWrite(jobData.manifest);
 
@@ -3,6 +3,8 @@ Verify File
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/archive/common.h"
+#include "command/archive/walTail.h"
 #include "command/verify/file.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
@@ -12,12 +14,14 @@ Verify File
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
+#include "common/regExp.h"
 #include "storage/helper.h"
 
-/**********************************************************************************************************************************/
-VerifyResult
-verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass)
+/***********************************************************************************************************************************
+Verify the checksum and size of a single file
+***********************************************************************************************************************************/
+static VerifyResult
+verifyFileOne(const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, filePathName);                   // Fully qualified file name
@@ -46,6 +50,10 @@ verifyFile(
         if (compressTypeFromName(filePathName) != compressTypeNone)
             ioFilterGroupAdd(filterGroup, decompressFilter(compressTypeFromName(filePathName)));
 
+        // Restore the zero tail of archived WAL segments that were trimmed by archive-push
+        if (regExpMatchOne(WAL_SEGMENT_FILE_REGEXP_STR, strBase(filePathName)) && walIsTrimmed(filePathName))
+            ioFilterGroupAdd(filterGroup, walTailPadNew());
+
         // Add sha1 filter
         ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
 
@@ -74,3 +82,35 @@ verifyFile(
 
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
+
+/**********************************************************************************************************************************/
+VerifyResult
+verifyFile(
+    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass,
+    const String *blockFilePathName, const String *blockChecksum, unsigned int blockSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, filePathName);                   // Fully qualified file name
+        FUNCTION_LOG_PARAM(STRING, fileChecksum);                   // Checksum for the file
+        FUNCTION_LOG_PARAM(UINT64, fileSize);                       // Size of file
+        FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
+        FUNCTION_LOG_PARAM(STRING, blockFilePathName);              // Fully qualified block checksum file name (NULL if none)
+        FUNCTION_LOG_PARAM(STRING, blockChecksum);                  // Checksum for the block checksum file
+        FUNCTION_LOG_PARAM(UINT, blockSize);                        // Block size of the block checksums
+    FUNCTION_LOG_END();
+
+    ASSERT(filePathName != NULL);
+    ASSERT(fileChecksum != NULL);
+    ASSERT(blockFilePathName == NULL || (blockChecksum != NULL && blockSize > 0));
+
+    VerifyResult result = verifyFileOne(filePathName, fileChecksum, fileSize, cipherPass);
+
+    // Verify the block checksums when the file is valid. There is one checksum for each block, including a partial last block.
+    if (result == verifyOk && blockFilePathName != NULL)
+    {
+        result = verifyFileOne(
+            blockFilePathName, blockChecksum, (fileSize + blockSize - 1) / blockSize * HASH_TYPE_SHA1_SIZE_HEX, cipherPass);
+    }
+
+    FUNCTION_LOG_RETURN_STRUCT(result);
+}
@@ -22,8 +22,9 @@ typedef enum
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
-// Verify a file in the pgBackRest repository
+// Verify a file in the pgBackRest repository and the block checksums stored with it, if any
 VerifyResult verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass);
+    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass,
+    const String *blockFilePathName, const String *blockChecksum, unsigned int blockSize);
 
 #endif
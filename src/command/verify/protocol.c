@@ -41,7 +41,10 @@ verifyProtocol(const String *command, const VariantList *paramList, ProtocolServ
                 varStr(varLstGet(paramList, 0)),                                                    // Full filename
                 varStr(varLstGet(paramList, 1)),                                                    // Checksum
                 varUInt64(varLstGet(paramList, 2)),                                                 // File size
-                varStr(varLstGet(paramList, 3)));                                                   // Cipher pass
+                varStr(varLstGet(paramList, 3)),                                                    // Cipher pass
+                varStr(varLstGet(paramList, 4)),                                                    // Block checksum filename
+                varStr(varLstGet(paramList, 5)),                                                    // Block checksum file checksum
+                varUIntForce(varLstGet(paramList, 6)));                                             // Block size
 
             protocolServerResponse(server, VARUINT(result));
         }
@@ -760,6 +760,11 @@ verifyArchive(void *data)
                         protocolCommandParamAdd(command, VARUINT64(archiveResult->pgWalInfo.size));
                         protocolCommandParamAdd(command, VARSTR(jobData->walCipherPass));
 
+                        // WAL does not have block checksums
+                        protocolCommandParamAdd(command, NULL);
+                        protocolCommandParamAdd(command, NULL);
+                        protocolCommandParamAdd(command, VARUINT(0));
+
                         // Assign job to result, prepending the archiveId to the key for consistency with backup processing
                         result = protocolParallelJobNew(
                             VARSTR(strNewFmt("%s/%s", strZ(archiveResult->archiveId), strZ(filePathName))), command);
@@ -910,6 +915,10 @@ verifyBackup(void *data)
 
                 String *filePathName = NULL;
 
+                // Files that were found to be incompressible during backup are stored without compression
+                const CompressType fileCompressType =
+                    fileData->compressSkip ? compressTypeNone : manifestData(jobData->manifest)->backupOptionCompressType;
+
                 // Track the files verified in order to determine when the processing of the backup is complete
                 backupResult->totalFileVerify++;
 
@@ -924,7 +933,7 @@ verifyBackup(void *data)
                     {
                         filePathName = strNewFmt(
                             STORAGE_REPO_BACKUP "/%s/%s%s", strZ(fileData->reference), strZ(fileData->name),
-                            strZ(compressExtStr((manifestData(jobData->manifest))->backupOptionCompressType)));
+                            strZ(compressExtStr(fileCompressType)));
                     }
                     // Else the backup this file references has a result so check the processing state for the referenced backup
                     else
@@ -936,14 +945,14 @@ verifyBackup(void *data)
                         {
                             filePathName = strNewFmt(
                                 STORAGE_REPO_BACKUP "/%s/%s%s", strZ(fileData->reference), strZ(fileData->name),
-                                strZ(compressExtStr((manifestData(jobData->manifest))->backupOptionCompressType)));
+                                strZ(compressExtStr(fileCompressType)));
                         }
                         // Else skip verification
                         else
                         {
                             String *priorFile = strNewFmt(
                                 "%s/%s%s", strZ(fileData->reference), strZ(fileData->name),
-                                strZ(compressExtStr((manifestData(jobData->manifest))->backupOptionCompressType)));
+                                strZ(compressExtStr(fileCompressType)));
 
                             unsigned int backupPriorInvalidIdx = lstFindIdx(backupResultPrior->invalidFileList, &priorFile);
 
@@ -970,7 +979,7 @@ verifyBackup(void *data)
                 {
                     filePathName = strNewFmt(
                         STORAGE_REPO_BACKUP "/%s/%s%s", strZ(backupResult->backupLabel), strZ(fileData->name),
-                        strZ(compressExtStr((manifestData(jobData->manifest))->backupOptionCompressType)));
+                        strZ(compressExtStr(fileCompressType)));
                 }
 
                 // If constructed file name is not null then send it off for processing
@@ -985,6 +994,19 @@ verifyBackup(void *data)
                     protocolCommandParamAdd(command, VARUINT64(fileData->size));
                     protocolCommandParamAdd(command, VARSTR(jobData->backupCipherPass));
 
+                    // Block checksums are stored in the same backup as the file
+                    protocolCommandParamAdd(
+                        command,
+                        fileData->checksumBlockSize != 0 ?
+                            VARSTR(
+                                strNewFmt(
+                                    STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s",
+                                    strZ(fileData->reference != NULL ? fileData->reference : backupResult->backupLabel),
+                                    strZ(fileData->name))) :
+                            NULL);
+                    protocolCommandParamAdd(command, VARSTR(fileData->checksumBlockSha1));
+                    protocolCommandParamAdd(command, VARUINT(fileData->checksumBlockSize));
+
                     // Assign job to result (prepend backup label being processed to the key since some files are in a prior backup)
                     result = protocolParallelJobNew(
                         VARSTR(strNewFmt("%s/%s", strZ(backupResult->backupLabel), strZ(filePathName))), command);
@@ -20,6 +20,7 @@ Compression Helper
 #include "common/compress/zst/decompress.h"
 #include "common/debug.h"
 #include "common/log.h"
+#include "common/time.h"
 #include "version.h"
 
 /***********************************************************************************************************************************
@@ -42,6 +43,8 @@ static const struct CompressHelperLocal
     const char *decompressType;                                     // Type of the decompression filter
     IoFilter *(*decompressNew)(void);                               // Function to create new decompression filter
     int levelDefault;                                               // Default compression level
+    int levelMin;                                                   // Minimum level for adaptive compression
+    int levelMax;                                                   // Maximum level for adaptive compression
 } compressHelperLocal[] =
 {
     {
@@ -56,6 +59,8 @@ static const struct CompressHelperLocal
         .decompressType = BZ2_DECOMPRESS_FILTER_TYPE,
         .decompressNew = bz2DecompressNew,
         .levelDefault = 9,
+        .levelMin = 1,
+        .levelMax = 9,
     },
     {
         .type = STRDEF(GZ_EXT),
@@ -65,6 +70,8 @@ static const struct CompressHelperLocal
         .decompressType = GZ_DECOMPRESS_FILTER_TYPE,
         .decompressNew = gzDecompressNew,
         .levelDefault = 6,
+        .levelMin = 1,
+        .levelMax = 9,
     },
     {
         .type = STRDEF(LZ4_EXT),
@@ -75,6 +82,8 @@ static const struct CompressHelperLocal
         .decompressType = LZ4_DECOMPRESS_FILTER_TYPE,
         .decompressNew = lz4DecompressNew,
         .levelDefault = 1,
+        .levelMin = 1,
+        .levelMax = 12,
 #endif
     },
     {
@@ -86,6 +95,8 @@ static const struct CompressHelperLocal
         .decompressType = ZST_DECOMPRESS_FILTER_TYPE,
         .decompressNew = zstDecompressNew,
         .levelDefault = 3,
+        .levelMin = 1,
+        .levelMax = 19,
 #endif
     },
     {
@@ -101,6 +112,34 @@ static const struct CompressHelperLocal
 #define COMPRESS_LIST_SIZE                                                                                                         \
     (sizeof(compressHelperLocal) / sizeof(struct CompressHelperLocal))
 
+/***********************************************************************************************************************************
+Adaptive compression level. The level is tracked per process so each local process adapts to its own throughput.
+***********************************************************************************************************************************/
+// Time that must be accumulated before the level is adjusted. Timing is sampled with millisecond resolution so short intervals are
+// mostly zero, but the accumulated total is accurate enough once it covers a reasonable amount of time.
+#define COMPRESS_LEVEL_ADAPTIVE_SAMPLE_MSEC                         ((TimeMSec)1000)
+
+// One side must be this many times slower than the other before the level is adjusted
+#define COMPRESS_LEVEL_ADAPTIVE_RATIO                               2
+
+/***********************************************************************************************************************************
+Compressibility probe. Byte entropy is calculated in fixed point with COMPRESS_PROBE_FRACTION_BITS fractional bits so no floating
+point math (or libm) is required.
+***********************************************************************************************************************************/
+#define COMPRESS_PROBE_FRACTION_BITS                                16
+
+// Samples with byte entropy above this many bits per byte (in fixed point) are considered incompressible. Random data is very close
+// to 8 bits per byte, while data that gzip can shrink meaningfully is well below this.
+#define COMPRESS_PROBE_ENTROPY_MAX                                  ((uint64_t)15 << (COMPRESS_PROBE_FRACTION_BITS - 1))
+
+static struct CompressLevelAdaptiveLocal
+{
+    CompressType type;                                              // Compress type the level applies to
+    int level;                                                      // Current level
+    TimeMSec produceTime;                                           // Time spent reading and compressing
+    TimeMSec sinkTime;                                              // Time spent writing compressed data
+} compressLevelAdaptiveLocal;
+
 /**********************************************************************************************************************************/
 CompressType
 compressTypeEnum(const String *type)
@@ -190,6 +229,151 @@ compressLevelDefault(CompressType type)
     FUNCTION_TEST_RETURN(compressHelperLocal[type].levelDefault);
 }
 
+/**********************************************************************************************************************************/
+int
+compressLevelAdaptive(CompressType type, int level)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(INT, level);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+    ASSERT(type != compressTypeNone);
+    compressTypePresent(type);
+
+    // Initialize the level on first use or when the compress type changes
+    if (compressLevelAdaptiveLocal.type != type)
+    {
+        const struct CompressHelperLocal *const compress = &compressHelperLocal[type];
+
+        compressLevelAdaptiveLocal = (struct CompressLevelAdaptiveLocal)
+        {
+            .type = type,
+            .level = level < compress->levelMin ? compress->levelMin : level > compress->levelMax ? compress->levelMax : level,
+        };
+    }
+
+    FUNCTION_TEST_RETURN(compressLevelAdaptiveLocal.level);
+}
+
+/**********************************************************************************************************************************/
+void
+compressLevelAdaptiveUpdate(CompressType type, TimeMSec produceTime, TimeMSec sinkTime)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(TIME_MSEC, produceTime);
+        FUNCTION_TEST_PARAM(TIME_MSEC, sinkTime);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+
+    // Only update when the level has been initialized for this type
+    if (compressLevelAdaptiveLocal.type == type)
+    {
+        compressLevelAdaptiveLocal.produceTime += produceTime;
+        compressLevelAdaptiveLocal.sinkTime += sinkTime;
+
+        // Adjust once enough time has accumulated to give a reliable measurement
+        if (compressLevelAdaptiveLocal.produceTime + compressLevelAdaptiveLocal.sinkTime >= COMPRESS_LEVEL_ADAPTIVE_SAMPLE_MSEC)
+        {
+            const struct CompressHelperLocal *const compress = &compressHelperLocal[type];
+
+            // If writing is the bottleneck then there is CPU to spare so compress harder to send less data
+            if (compressLevelAdaptiveLocal.sinkTime > compressLevelAdaptiveLocal.produceTime * COMPRESS_LEVEL_ADAPTIVE_RATIO)
+            {
+                if (compressLevelAdaptiveLocal.level < compress->levelMax)
+                    compressLevelAdaptiveLocal.level++;
+            }
+            // Else if compression is the bottleneck then compress less to keep up with the sink
+            else if (compressLevelAdaptiveLocal.produceTime > compressLevelAdaptiveLocal.sinkTime * COMPRESS_LEVEL_ADAPTIVE_RATIO)
+            {
+                if (compressLevelAdaptiveLocal.level > compress->levelMin)
+                    compressLevelAdaptiveLocal.level--;
+            }
+
+            compressLevelAdaptiveLocal.produceTime = 0;
+            compressLevelAdaptiveLocal.sinkTime = 0;
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+// Calculate log2 of an integer in fixed point
+static uint64_t
+compressProbeLog2(uint64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(value > 0);
+
+    // Integer part is the position of the highest set bit
+    uint64_t result = 0;
+
+    while (value >> (result + 1) != 0)
+        result++;
+
+    // Fractional part is calculated one bit at a time by squaring the normalized value, which doubles its log. The value is kept in
+    // fixed point with 31 fractional bits so squaring fits in 64 bits.
+    uint64_t normal = result > 31 ? value >> (result - 31) : value << (31 - result);
+
+    result <<= COMPRESS_PROBE_FRACTION_BITS;
+
+    for (unsigned int bitIdx = 1; bitIdx <= COMPRESS_PROBE_FRACTION_BITS; bitIdx++)
+    {
+        normal = (normal * normal) >> 31;
+
+        if (normal >= (uint64_t)2 << 31)
+        {
+            normal >>= 1;
+            result |= (uint64_t)1 << (COMPRESS_PROBE_FRACTION_BITS - bitIdx);
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+bool
+compressProbe(const Buffer *sample)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, sample);
+    FUNCTION_TEST_END();
+
+    ASSERT(sample != NULL);
+
+    bool result = true;
+
+    if (!bufEmpty(sample))
+    {
+        // Count occurrences of each byte value
+        uint64_t count[256] = {0};
+        const unsigned char *const data = bufPtrConst(sample);
+        const uint64_t size = bufUsed(sample);
+
+        for (size_t dataIdx = 0; dataIdx < size; dataIdx++)
+            count[data[dataIdx]]++;
+
+        // Entropy in bits per byte is log2(size) - sum(count * log2(count)) / size. Multiply through by size to avoid division.
+        uint64_t countLogTotal = 0;
+
+        for (unsigned int countIdx = 0; countIdx < 256; countIdx++)
+        {
+            if (count[countIdx] != 0)
+                countLogTotal += count[countIdx] * compressProbeLog2(count[countIdx]);
+        }
+
+        result = size * compressProbeLog2(size) - countLogTotal <= size * COMPRESS_PROBE_ENTROPY_MAX;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 IoFilter *
 compressFilter(CompressType type, int level)
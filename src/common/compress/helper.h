@@ -28,6 +28,7 @@ typedef enum
 
 #include <common/type/string.h>
 #include <common/io/filter/group.h>
+#include <common/time.h>
 
 /***********************************************************************************************************************************
 Compression types as a regexp. In the future this regexp will be generated automatically at build time but we want to wait until the
@@ -52,6 +53,21 @@ const String *compressTypeStr(CompressType type);
 // compressType none is returned, even if the file is compressed with some unknown type.
 CompressType compressTypeFromName(const String *name);
 
+// Get the current adaptive compression level for the type. The level starts at the passed level (clamped to the range supported by
+// the type) and is then adjusted by compressLevelAdaptiveUpdate().
+int compressLevelAdaptive(CompressType type, int level);
+
+// Report time spent reading/compressing and time spent writing the compressed output. When enough time has accumulated the level is
+// raised if writing is the bottleneck or lowered if compression is the bottleneck.
+void compressLevelAdaptiveUpdate(CompressType type, TimeMSec produceTime, TimeMSec sinkTime);
+
+// Size of the sample that should be passed to compressProbe()
+#define COMPRESS_PROBE_SIZE                                         ((size_t)64 * 1024)
+
+// Estimate whether data is worth compressing from a sample, usually the start of a file. Returns false when the sample is close to
+// random, e.g. data that has already been compressed or encrypted.
+bool compressProbe(const Buffer *sample);
+
 // Compression filter for the specified type.  Error when compress type is none or invalid.
 IoFilter *compressFilter(CompressType type, int level);
 
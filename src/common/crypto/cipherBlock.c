@@ -29,9 +29,24 @@ Header constants and sizes
 #define CIPHER_BLOCK_MAGIC                                          "Salted__"
 #define CIPHER_BLOCK_MAGIC_SIZE                                     (sizeof(CIPHER_BLOCK_MAGIC) - 1)
 
+// Magic constant for chunked encrypt. The header is otherwise the same as salted encrypt.
+#define CIPHER_BLOCK_CHUNK_MAGIC                                    "Chunked_"
+
 // Total length of cipher header
 #define CIPHER_BLOCK_HEADER_SIZE                                    (CIPHER_BLOCK_MAGIC_SIZE + PKCS5_SALT_LEN)
 
+/***********************************************************************************************************************************
+Chunk constants and sizes
+
+In the chunked format (used by authenticated ciphers) the data is split into chunks that are encrypted separately and each followed
+by an authentication tag. The nonce of each chunk is the nonce generated with the key xor'd with the chunk number, so a chunk can be
+decrypted without decrypting the chunks before it. The final chunk (which may be empty) is authenticated as final so a truncated
+file cannot pass for a complete one.
+***********************************************************************************************************************************/
+#define CIPHER_BLOCK_CHUNK_SIZE                                     ((size_t)64 * 1024)
+#define CIPHER_BLOCK_CHUNK_TAG_SIZE                                 16
+#define CIPHER_BLOCK_CHUNK_NONCE_SIZE                               12
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -52,6 +67,11 @@ typedef struct CipherBlock
     const EVP_MD *digest;                                           // Message digest object
     EVP_CIPHER_CTX *cipherContext;                                  // Encrypt/decrypt context
 
+    bool chunked;                                                   // Is the chunked format used?
+    unsigned char nonce[CIPHER_BLOCK_CHUNK_NONCE_SIZE];             // Nonce generated with the key for chunks
+    uint64_t chunkNo;                                               // Number of the next chunk
+    Buffer *chunk;                                                  // Chunk waiting to be encrypted/decrypted
+
     Buffer *buffer;                                                 // Internal buffer in case destination buffer isn't large enough
     bool inputSame;                                                 // Is the same input required on next process call?
     bool done;                                                      // Is processing done?
@@ -97,6 +117,14 @@ cipherBlockProcessSize(CipherBlock *this, size_t sourceSize)
     // Destination size is source size plus one extra block
     size_t destinationSize = sourceSize + EVP_MAX_BLOCK_LENGTH;
 
+    // Add data waiting in the chunk since it may be output with the source
+    if (this->chunk != NULL)
+        destinationSize += bufUsed(this->chunk);
+
+    // On chunked encrypt each chunk adds a tag
+    if (this->mode == cipherModeEncrypt && this->chunked)
+        destinationSize += (destinationSize / CIPHER_BLOCK_CHUNK_SIZE + 1) * CIPHER_BLOCK_CHUNK_TAG_SIZE;
+
     // On encrypt the header size must be included before the first block
     if (this->mode == cipherModeEncrypt && !this->saltDone)
         destinationSize += CIPHER_BLOCK_MAGIC_SIZE + PKCS5_SALT_LEN;
@@ -104,6 +132,88 @@ cipherBlockProcessSize(CipherBlock *this, size_t sourceSize)
     FUNCTION_LOG_RETURN(SIZE, destinationSize);
 }
 
+/***********************************************************************************************************************************
+Encrypt/decrypt the data waiting in the chunk
+***********************************************************************************************************************************/
+static size_t
+cipherBlockChunk(CipherBlock *this, bool final, unsigned char *destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CIPHER_BLOCK, this);
+        FUNCTION_LOG_PARAM(BOOL, final);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->chunk != NULL);
+    ASSERT(destination != NULL);
+
+    // Set the nonce for this chunk
+    unsigned char nonce[CIPHER_BLOCK_CHUNK_NONCE_SIZE];
+    memcpy(nonce, this->nonce, sizeof(nonce));
+
+    for (unsigned int nonceIdx = 0; nonceIdx < sizeof(this->chunkNo); nonceIdx++)
+        nonce[sizeof(nonce) - nonceIdx - 1] ^= (unsigned char)(this->chunkNo >> (nonceIdx * 8));
+
+    cryptoError(!EVP_CipherInit_ex(this->cipherContext, NULL, NULL, NULL, nonce, -1), "unable to initialize cipher chunk");
+
+    // Authenticate whether this is the final chunk
+    const unsigned char chunkFinal = final;
+    int updateSize = 0;
+
+    cryptoError(!EVP_CipherUpdate(this->cipherContext, NULL, &updateSize, &chunkFinal, 1), "unable to process cipher");
+
+    // On decrypt the tag follows the data
+    size_t dataSize = bufUsed(this->chunk);
+
+    if (this->mode == cipherModeDecrypt)
+    {
+        if (dataSize < CIPHER_BLOCK_CHUNK_TAG_SIZE)
+            THROW(CryptoError, "cipher chunk is truncated");
+
+        dataSize -= CIPHER_BLOCK_CHUNK_TAG_SIZE;
+
+        cryptoError(
+            !EVP_CIPHER_CTX_ctrl(
+                this->cipherContext, EVP_CTRL_GCM_SET_TAG, CIPHER_BLOCK_CHUNK_TAG_SIZE, bufPtr(this->chunk) + dataSize),
+            "unable to set cipher tag");
+    }
+
+    // Process the data
+    size_t destinationSize = 0;
+
+    if (dataSize > 0)
+    {
+        cryptoError(
+            !EVP_CipherUpdate(this->cipherContext, destination, &updateSize, bufPtr(this->chunk), (int)dataSize),
+            "unable to process cipher");
+
+        destinationSize += (size_t)updateSize;
+    }
+
+    // Finish the chunk. On decrypt this fails when the data does not match the tag.
+    if (!EVP_CipherFinal_ex(this->cipherContext, destination + destinationSize, &updateSize))
+        THROW(CryptoError, "cipher chunk authentication failed");
+
+    destinationSize += (size_t)updateSize;
+
+    // On encrypt add the tag after the data
+    if (this->mode == cipherModeEncrypt)
+    {
+        cryptoError(
+            !EVP_CIPHER_CTX_ctrl(
+                this->cipherContext, EVP_CTRL_GCM_GET_TAG, CIPHER_BLOCK_CHUNK_TAG_SIZE, destination + destinationSize),
+            "unable to get cipher tag");
+
+        destinationSize += CIPHER_BLOCK_CHUNK_TAG_SIZE;
+    }
+
+    bufUsedZero(this->chunk);
+    this->chunkNo++;
+
+    FUNCTION_LOG_RETURN(SIZE, destinationSize);
+}
+
 /***********************************************************************************************************************************
 Encrypt/decrypt data
 ***********************************************************************************************************************************/
@@ -132,8 +242,8 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
         // On encrypt the salt is generated
         if (this->mode == cipherModeEncrypt)
         {
-            // Add magic to the destination buffer so openssl knows the file is salted
-            memcpy(destination, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE);
+            // Add magic to the destination buffer so openssl knows the file is salted (or so the chunked format is recognized)
+            memcpy(destination, this->chunked ? CIPHER_BLOCK_CHUNK_MAGIC : CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE);
             destination += CIPHER_BLOCK_MAGIC_SIZE;
             destinationSize += CIPHER_BLOCK_MAGIC_SIZE;
 
@@ -159,8 +269,16 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
 
                 // The first bytes of the file to decrypt should be equal to the magic.  If not then this is not an
                 // encrypted file, or at least not in a format we recognize.
-                if (memcmp(this->header, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) != 0)
+                if (memcmp(this->header, CIPHER_BLOCK_CHUNK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0)
+                    this->chunked = true;
+                else if (memcmp(this->header, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0)
+                    this->chunked = false;
+                else
                     THROW(CryptoError, "cipher header invalid");
+
+                // The format determines the cipher so files written with a prior cipher type can still be read
+                this->cipher = EVP_get_cipherbyname(
+                    strZ(cipherTypeName(this->chunked ? cipherTypeAes256Gcm : cipherTypeAes256Cbc)));
             }
             // Else copy what was provided into the header buffer and return 0
             else
@@ -189,12 +307,24 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
             // Set free callback to ensure cipher context is freed
             memContextCallbackSet(this->memContext, cipherBlockFreeResource, this);
 
-            // Initialize cipher
+            // Initialize cipher. In the chunked format the nonce is set for each chunk.
             cryptoError(
                 !EVP_CipherInit_ex(
-                    this->cipherContext, this->cipher, NULL, key, initVector, this->mode == cipherModeEncrypt),
+                    this->cipherContext, this->cipher, NULL, key, this->chunked ? NULL : initVector,
+                    this->mode == cipherModeEncrypt),
                     "unable to initialize cipher");
 
+            if (this->chunked)
+            {
+                memcpy(this->nonce, initVector, CIPHER_BLOCK_CHUNK_NONCE_SIZE);
+
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->chunk = bufNew(CIPHER_BLOCK_CHUNK_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE);
+                }
+                MEM_CONTEXT_END();
+            }
+
             this->saltDone = true;
         }
     }
@@ -202,14 +332,44 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
     // Recheck that source size > 0 as the bytes may have been consumed reading the header
     if (sourceSize > 0)
     {
-        // Process the data
-        int destinationUpdateSize = 0;
+        // Process the data in chunks
+        if (this->chunked)
+        {
+            // On decrypt the chunk includes the tag
+            const size_t chunkSize =
+                CIPHER_BLOCK_CHUNK_SIZE + (this->mode == cipherModeDecrypt ? CIPHER_BLOCK_CHUNK_TAG_SIZE : 0);
 
-        cryptoError(
-            !EVP_CipherUpdate(this->cipherContext, destination, &destinationUpdateSize, source, (int)sourceSize),
-            "unable to process cipher");
+            do
+            {
+                // A full chunk is processed only when more data follows so the final chunk is always processed on flush
+                if (bufUsed(this->chunk) == chunkSize)
+                {
+                    const size_t chunkDestinationSize = cipherBlockChunk(this, false, destination);
+
+                    destination += chunkDestinationSize;
+                    destinationSize += chunkDestinationSize;
+                }
+
+                const size_t catSize =
+                    sourceSize < chunkSize - bufUsed(this->chunk) ? sourceSize : chunkSize - bufUsed(this->chunk);
+
+                bufCatC(this->chunk, source, 0, catSize);
+                source += catSize;
+                sourceSize -= catSize;
+            }
+            while (sourceSize > 0);
+        }
+        // Else process the data as a stream
+        else
+        {
+            int destinationUpdateSize = 0;
 
-        destinationSize += (size_t)destinationUpdateSize;
+            cryptoError(
+                !EVP_CipherUpdate(this->cipherContext, destination, &destinationUpdateSize, source, (int)sourceSize),
+                "unable to process cipher");
+
+            destinationSize += (size_t)destinationUpdateSize;
+        }
 
         // Note that data has been processed so flush is valid
         this->processDone = true;
@@ -234,18 +394,28 @@ cipherBlockFlush(CipherBlock *this, Buffer *destination)
     ASSERT(destination != NULL);
 
     // Actual destination size
-    int destinationSize = 0;
+    size_t destinationSize = 0;
 
     // If no header was processed then error
     if (!this->saltDone)
         THROW(CryptoError, "cipher header missing");
 
-    // Only flush remaining data if some data was processed
-    if (!EVP_CipherFinal(this->cipherContext, bufRemainsPtr(destination), &destinationSize))
-        THROW(CryptoError, "unable to flush");
+    // Process the final chunk
+    if (this->chunked)
+        destinationSize = cipherBlockChunk(this, true, bufRemainsPtr(destination));
+    // Else flush remaining data
+    else
+    {
+        int destinationFlushSize = 0;
+
+        if (!EVP_CipherFinal(this->cipherContext, bufRemainsPtr(destination), &destinationFlushSize))
+            THROW(CryptoError, "unable to flush");
+
+        destinationSize = (size_t)destinationFlushSize;
+    }
 
     // Return actual destination size
-    FUNCTION_LOG_RETURN(SIZE, (size_t)destinationSize);
+    FUNCTION_LOG_RETURN(SIZE, destinationSize);
 }
 
 /***********************************************************************************************************************************
@@ -428,6 +598,7 @@ cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const
             .mode = mode,
             .cipher = cipher,
             .digest = digest,
+            .chunked = cipherType == cipherTypeAes256Gcm,
             .passSize = bufUsed(pass),
         };
 
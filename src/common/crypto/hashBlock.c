@@ -0,0 +1,199 @@
+/***********************************************************************************************************************************
+Cryptographic Block Hash
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <openssl/evp.h>
+
+#include "common/crypto/common.h"
+#include "common/crypto/hash.h"
+#include "common/crypto/hashBlock.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(CRYPTO_HASH_BLOCK_FILTER_TYPE_STR,                    CRYPTO_HASH_BLOCK_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define CRYPTO_HASH_BLOCK_TYPE                                      CryptoHashBlock
+#define CRYPTO_HASH_BLOCK_PREFIX                                    cryptoHashBlock
+
+typedef struct CryptoHashBlock
+{
+    MemContext *memContext;                                         // Context to store data
+    size_t blockSize;                                               // Size of each block to hash
+    size_t blockUsed;                                               // Bytes added to the hash of the current block
+    EVP_MD_CTX *hashContext;                                        // Hash context for the current block
+    Buffer *hash;                                                   // Hash of the last completed block
+    String *hashList;                                               // Hex hashes of all completed blocks
+} CryptoHashBlock;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_CRYPTO_HASH_BLOCK_TYPE                                                                                        \
+    CryptoHashBlock *
+#define FUNCTION_LOG_CRYPTO_HASH_BLOCK_FORMAT(value, buffer, bufferSize)                                                           \
+    objToLog(value, "CryptoHashBlock", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free hash context
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(CRYPTO_HASH_BLOCK, LOG, logLevelTrace)
+{
+    EVP_MD_CTX_destroy(this->hashContext);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Finish the hash of the current block, add it to the list, and start the next block
+***********************************************************************************************************************************/
+static void
+cryptoHashBlockNext(CryptoHashBlock *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CRYPTO_HASH_BLOCK, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    cryptoError(!EVP_DigestFinal_ex(this->hashContext, bufPtr(this->hash), NULL), "unable to finalize message hash");
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        strCat(this->hashList, bufHex(this->hash));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    cryptoError(!EVP_DigestInit_ex(this->hashContext, EVP_sha1(), NULL), "unable to initialize hash context");
+    this->blockUsed = 0;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Add data to the block hashes
+***********************************************************************************************************************************/
+static void
+cryptoHashBlockProcess(THIS_VOID, const Buffer *input)
+{
+    THIS(CryptoHashBlock);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CRYPTO_HASH_BLOCK, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+
+    const unsigned char *inputPtr = bufPtrConst(input);
+    size_t inputRemaining = bufUsed(input);
+
+    while (inputRemaining > 0)
+    {
+        // Add as much of the input as will fit in the current block
+        size_t inputSize = this->blockSize - this->blockUsed;
+
+        if (inputSize > inputRemaining)
+            inputSize = inputRemaining;
+
+        cryptoError(!EVP_DigestUpdate(this->hashContext, inputPtr, inputSize), "unable to process message hash");
+
+        inputPtr += inputSize;
+        inputRemaining -= inputSize;
+        this->blockUsed += inputSize;
+
+        // Finish the block when it is full
+        if (this->blockUsed == this->blockSize)
+            cryptoHashBlockNext(this);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the list of block hashes as a filter result
+***********************************************************************************************************************************/
+static Variant *
+cryptoHashBlockResult(THIS_VOID)
+{
+    THIS(CryptoHashBlock);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CRYPTO_HASH_BLOCK, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Finish the last block if it is partial
+    if (this->blockUsed != 0)
+        cryptoHashBlockNext(this);
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewStr(this->hashList));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+cryptoHashBlockNew(size_t blockSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SIZE, blockSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(blockSize > 0);
+
+    // Init crypto subsystem
+    cryptoInit();
+
+    // Allocate memory to hold process state
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("CryptoHashBlock")
+    {
+        CryptoHashBlock *driver = memNew(sizeof(CryptoHashBlock));
+
+        *driver = (CryptoHashBlock)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .blockSize = blockSize,
+            .hash = bufNew(HASH_TYPE_SHA1_SIZE),
+            .hashList = strNew(""),
+        };
+
+        bufUsedSet(driver->hash, bufSize(driver->hash));
+
+        // Create context
+        cryptoError((driver->hashContext = EVP_MD_CTX_create()) == NULL, "unable to create hash context");
+
+        // Set free callback to ensure hash context is freed
+        memContextCallbackSet(driver->memContext, cryptoHashBlockFreeResource, driver);
+
+        // Initialize context
+        cryptoError(!EVP_DigestInit_ex(driver->hashContext, EVP_sha1(), NULL), "unable to initialize hash context");
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt64(blockSize));
+
+        // Create filter interface
+        this = ioFilterNewP(
+            CRYPTO_HASH_BLOCK_FILTER_TYPE_STR, driver, paramList, .in = cryptoHashBlockProcess, .result = cryptoHashBlockResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+cryptoHashBlockNewVar(const VariantList *paramList)
+{
+    return cryptoHashBlockNew((size_t)varUInt64Force(varLstGet(paramList, 0)));
+}
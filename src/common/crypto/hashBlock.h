@@ -0,0 +1,26 @@
+/***********************************************************************************************************************************
+Cryptographic Block Hash
+
+Generate a sha1 hash for each fixed-size block of the data passing through an IoFilter. The result is a string of concatenated hex
+hashes, one per block, so the hash of block n begins at offset n * HASH_TYPE_SHA1_SIZE_HEX. The last block may be shorter than the
+block size.
+***********************************************************************************************************************************/
+#ifndef COMMON_CRYPTO_HASHBLOCK_H
+#define COMMON_CRYPTO_HASHBLOCK_H
+
+#include "common/io/filter/filter.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define CRYPTO_HASH_BLOCK_FILTER_TYPE                               "hashBlock"
+    STRING_DECLARE(CRYPTO_HASH_BLOCK_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoFilter *cryptoHashBlockNew(size_t blockSize);
+IoFilter *cryptoHashBlockNewVar(const VariantList *paramList);
+
+#endif
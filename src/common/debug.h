@@ -30,7 +30,8 @@ Extern variables that are needed for unit testing
 Base function debugging macros
 
 In debug mode parameters will always be recorded in the stack trace while in production mode they will only be recorded when the log
-level is set to debug or trace.
+level is set to debug or trace. In lite stack trace mode only function names are recorded and function logging is compiled out so
+the parameter code is never executed.
 ***********************************************************************************************************************************/
 #define FUNCTION_LOG_LEVEL()                                                                                                       \
     FUNCTION_LOG_logLevel
@@ -47,6 +48,15 @@ level is set to debug or trace.
             stackTraceTestStart();                                                                                                 \
             LOG_FMT(FUNCTION_LOG_LEVEL(), 0, "(%s)", stackTraceParam());                                                           \
         }
+#elif defined(STACK_TRACE_LITE)
+    #define FUNCTION_LOG_BEGIN_BASE(logLevel)                                                                                      \
+        STACK_TRACE_PUSH(logLevel);                                                                                                \
+                                                                                                                                   \
+        if (false)                                                                                                                 \
+        {
+
+    #define FUNCTION_LOG_END_BASE()                                                                                                \
+        }
 #else
     #define FUNCTION_LOG_BEGIN_BASE(logLevel)                                                                                      \
         LogLevel FUNCTION_LOG_LEVEL() = STACK_TRACE_PUSH(logLevel);                                                                \
@@ -232,6 +242,33 @@ size_t typeToLog(const char *typeName, char *buffer, size_t bufferSize);
 /***********************************************************************************************************************************
 Macros to return function results (or void)
 ***********************************************************************************************************************************/
+#ifdef STACK_TRACE_LITE
+
+#define FUNCTION_LOG_RETURN_BASE(typePre, typeMacroPrefix, typePost, result)                                                       \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        typePre FUNCTION_LOG_##typeMacroPrefix##_TYPE typePost FUNCTION_LOG_RETURN_result = result;                                \
+                                                                                                                                   \
+        STACK_TRACE_POP(false);                                                                                                    \
+                                                                                                                                   \
+        return FUNCTION_LOG_RETURN_result;                                                                                         \
+    }                                                                                                                              \
+    while (0)
+
+#define FUNCTION_LOG_RETURN_STRUCT(result)                                                                                         \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        STACK_TRACE_POP(false);                                                                                                    \
+                                                                                                                                   \
+        return result;                                                                                                             \
+    }                                                                                                                              \
+    while (0)
+
+#define FUNCTION_LOG_RETURN_VOID()                                                                                                 \
+    STACK_TRACE_POP(false)
+
+#else
+
 #define FUNCTION_LOG_RETURN_BASE(typePre, typeMacroPrefix, typePost, result)                                                       \
     do                                                                                                                             \
     {                                                                                                                              \
@@ -251,24 +288,6 @@ Macros to return function results (or void)
     }                                                                                                                              \
     while (0)
 
-#define FUNCTION_LOG_RETURN(typeMacroPrefix, result)                                                                               \
-    FUNCTION_LOG_RETURN_BASE(, typeMacroPrefix, , result)
-
-#define FUNCTION_LOG_RETURN_P(typeMacroPrefix, result)                                                                             \
-    FUNCTION_LOG_RETURN_BASE(, typeMacroPrefix, *, result)
-
-#define FUNCTION_LOG_RETURN_PP(typeMacroPrefix, result)                                                                            \
-    FUNCTION_LOG_RETURN_BASE(, typeMacroPrefix, **, result)
-
-#define FUNCTION_LOG_RETURN_CONST(typeMacroPrefix, result)                                                                         \
-    FUNCTION_LOG_RETURN_BASE(const, typeMacroPrefix, , result)
-
-#define FUNCTION_LOG_RETURN_CONST_P(typeMacroPrefix, result)                                                                       \
-    FUNCTION_LOG_RETURN_BASE(const, typeMacroPrefix, *, result)
-
-#define FUNCTION_LOG_RETURN_CONST_PP(typeMacroPrefix, result)                                                                      \
-    FUNCTION_LOG_RETURN_BASE(const, typeMacroPrefix, **, result)
-
 #define FUNCTION_LOG_RETURN_STRUCT(result)                                                                                         \
     do                                                                                                                             \
     {                                                                                                                              \
@@ -290,6 +309,26 @@ Macros to return function results (or void)
     }                                                                                                                              \
     while (0)
 
+#endif // STACK_TRACE_LITE
+
+#define FUNCTION_LOG_RETURN(typeMacroPrefix, result)                                                                               \
+    FUNCTION_LOG_RETURN_BASE(, typeMacroPrefix, , result)
+
+#define FUNCTION_LOG_RETURN_P(typeMacroPrefix, result)                                                                             \
+    FUNCTION_LOG_RETURN_BASE(, typeMacroPrefix, *, result)
+
+#define FUNCTION_LOG_RETURN_PP(typeMacroPrefix, result)                                                                            \
+    FUNCTION_LOG_RETURN_BASE(, typeMacroPrefix, **, result)
+
+#define FUNCTION_LOG_RETURN_CONST(typeMacroPrefix, result)                                                                         \
+    FUNCTION_LOG_RETURN_BASE(const, typeMacroPrefix, , result)
+
+#define FUNCTION_LOG_RETURN_CONST_P(typeMacroPrefix, result)                                                                       \
+    FUNCTION_LOG_RETURN_BASE(const, typeMacroPrefix, *, result)
+
+#define FUNCTION_LOG_RETURN_CONST_PP(typeMacroPrefix, result)                                                                      \
+    FUNCTION_LOG_RETURN_BASE(const, typeMacroPrefix, **, result)
+
 /***********************************************************************************************************************************
 Function Test Macros
 
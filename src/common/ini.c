@@ -8,6 +8,7 @@ Ini Handler
 #include <string.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/memContext.h"
 #include "common/log.h"
 #include "common/ini.h"
@@ -333,7 +334,7 @@ iniSet(Ini *this, const String *section, const String *key, const String *value)
 void
 iniLoad(
     IoRead *read,
-    void (*callbackFunction)(void *data, const String *section, const String *key, const String *value, const Variant *valueVar),
+    void (*callbackFunction)(void *data, const String *section, const String *key, const String *value),
     void *callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
@@ -352,95 +353,142 @@ iniLoad(
         // Keep track of the line number for error reporting
         unsigned int lineIdx = 0;
 
+        // Lines are scanned in place in the read buffer. Keys and values are passed to the callback as constant strings that point
+        // into the buffer so they do not need to be copied. Only a partial line at the end of the buffer is moved before the next
+        // read, and the buffer only grows when a single line is larger than the buffer.
+        Buffer *buffer = bufNew(ioBufferSize());
+        bool eof = false;
+
+        ioReadOpen(read);
+
         MEM_CONTEXT_TEMP_RESET_BEGIN()
         {
-            ioReadOpen(read);
-
             do
             {
-                const String *line = ioReadLineParam(read, true);
-                const char *linePtr = strZ(line);
+                // Grow the buffer if the partial line fills it, then fill the remainder of the buffer
+                if (bufRemains(buffer) == 0)
+                    bufResize(buffer, bufSize(buffer) * 2);
+
+                ioRead(read, buffer);
+                eof = ioReadEof(read);
+
+                // Terminate the last line if needed so all lines can be processed the same way
+                if (eof && !bufEmpty(buffer) && bufPtr(buffer)[bufUsed(buffer) - 1] != '\n')
+                    bufCat(buffer, LF_BUF);
 
-                // Only interested in lines that are not blank
-                if (strSize(line) > 0)
+                char *const bufferPtr = (char *)bufPtr(buffer);
+                const size_t bufferUsed = bufUsed(buffer);
+                size_t linePos = 0;
+                char *lineEnd;
+
+                // Process all complete lines in the buffer
+                while ((lineEnd = memchr(bufferPtr + linePos, '\n', bufferUsed - linePos)) != NULL)
                 {
-                    // The line is a section. Since the value must be valid JSON this means that the value must never be an array.
-                    if (linePtr[0] == '[' && linePtr[strSize(line) - 1] == ']')
+                    char *const linePtr = bufferPtr + linePos;
+                    const size_t lineSize = (size_t)(lineEnd - linePtr);
+
+                    *lineEnd = '\0';
+                    linePos += lineSize + 1;
+
+                    // Only interested in lines that are not blank
+                    if (lineSize > 0)
                     {
-                        // Assign section
-                        MEM_CONTEXT_PRIOR_BEGIN()
+                        // The line is a section. Since the value must be valid JSON this means that the value must never be an
+                        // array.
+                        if (linePtr[0] == '[' && linePtr[lineSize - 1] == ']')
                         {
-                            section = strNewN(linePtr + 1, strSize(line) - 2);
+                            // Assign section
+                            MEM_CONTEXT_PRIOR_BEGIN()
+                            {
+                                strFree(section);
+                                section = strNewN(linePtr + 1, lineSize - 2);
+                            }
+                            MEM_CONTEXT_PRIOR_END();
                         }
-                        MEM_CONTEXT_PRIOR_END();
-                    }
-                    // Else it is a key/value
-                    else
-                    {
-                        if (section == NULL)
-                            THROW_FMT(FormatError, "key/value found outside of section at line %u: %s", lineIdx + 1, linePtr);
+                        // Else it is a key/value
+                        else
+                        {
+                            if (section == NULL)
+                                THROW_FMT(FormatError, "key/value found outside of section at line %u: %s", lineIdx + 1, linePtr);
 
-                        // Find the =
-                        const char *lineEqual = strstr(linePtr, "=");
+                            // Find the =
+                            char *lineEqual = strchr(linePtr, '=');
 
-                        if (lineEqual == NULL)
-                            THROW_FMT(FormatError, "missing '=' in key/value at line %u: %s", lineIdx + 1, linePtr);
+                            if (lineEqual == NULL)
+                                THROW_FMT(FormatError, "missing '=' in key/value at line %u: %s", lineIdx + 1, linePtr);
 
-                        // Extract the key/value. This may require some retries if the key includes an = character since this is
-                        // also the separator. We know the value must be valid JSON so if it isn't then add the characters up to
-                        // the next = to the key and try to parse the value as JSON again. If the value never becomes valid JSON
-                        // then an error is thrown.
-                        String *key;
-                        String *value;
-                        Variant *valueVar = NULL;
+                            // Find the value. This may require some retries if the key includes an = character since this is also
+                            // the separator. We know the value must be valid JSON so if it isn't then add the characters up to the
+                            // next = to the key and try to parse the value as JSON again. If the value never becomes valid JSON
+                            // then an error is thrown.
+                            bool retry;
 
-                        bool retry;
+                            do
+                            {
+                                retry = false;
+
+                                // Check that the value is valid JSON. The value is not converted since the callback may only need
+                                // part of it or may read it with a JSON reader.
+                                TRY_BEGIN()
+                                {
+                                    jsonValidate(
+                                        (const String *)&(const StringConst)
+                                        {
+                                            .buffer = lineEqual + 1,
+                                            .size = (unsigned int)(lineEnd - lineEqual - 1),
+                                        });
+                                }
+                                CATCH(JsonFormatError)
+                                {
+                                    // If value is not valid JSON look for another =. If not found then nothing to retry.
+                                    lineEqual = strchr(lineEqual + 1, '=');
+
+                                    if (lineEqual == NULL)
+                                        THROW_FMT(FormatError, "invalid JSON value at line %u: %s", lineIdx + 1, linePtr);
+
+                                    // Try again with = in new position
+                                    retry = true;
+                                }
+                                TRY_END();
+                            }
+                            while (retry);
 
-                        do
-                        {
-                            retry = false;
+                            // Key may not be zero-length
+                            if (lineEqual == linePtr)
+                                THROW_FMT(FormatError, "key is zero-length at line %u: %s", lineIdx, linePtr);
 
-                            // Get key/value
-                            key = strNewN(linePtr, (size_t)(lineEqual - linePtr));
-                            value = strNew(lineEqual + 1);
+                            // Terminate the key in place and callback with the section/key/value
+                            *lineEqual = '\0';
 
-                            // Check that the value is valid JSON
-                            TRY_BEGIN()
-                            {
-                                valueVar = jsonToVar(value);
-                            }
-                            CATCH(JsonFormatError)
+                            const String *const key = (const String *)&(const StringConst)
                             {
-                                // If value is not valid JSON look for another =. If not found then nothing to retry.
-                                lineEqual = strstr(lineEqual + 1, "=");
+                                .buffer = linePtr,
+                                .size = (unsigned int)(lineEqual - linePtr),
+                            };
 
-                                if (lineEqual == NULL)
-                                    THROW_FMT(FormatError, "invalid JSON value at line %u: %s", lineIdx + 1, linePtr);
+                            const String *const value = (const String *)&(const StringConst)
+                            {
+                                .buffer = lineEqual + 1,
+                                .size = (unsigned int)(lineEnd - lineEqual - 1),
+                            };
 
-                                // Try again with = in new position
-                                retry = true;
-                            }
-                            TRY_END();
+                            callbackFunction(callbackData, section, key, value);
                         }
-                        while (retry);
-
-                        // Key may not be zero-length
-                        if (strSize(key) == 0)
-                            THROW_FMT(FormatError, "key is zero-length at line %u: %s", lineIdx++, linePtr);
-
-                        // Callback with the section/key/value
-                        callbackFunction(callbackData, section, key, value, valueVar);
                     }
+
+                    lineIdx++;
+                    MEM_CONTEXT_TEMP_RESET(1000);
                 }
 
-                lineIdx++;
-                MEM_CONTEXT_TEMP_RESET(1000);
+                // Move the partial line (if any) to the beginning of the buffer
+                memmove(bufferPtr, bufferPtr + linePos, bufferUsed - linePos);
+                bufUsedSet(buffer, bufferUsed - linePos);
             }
-            while (!ioReadEof(read));
-
-            ioReadClose(read);
+            while (!eof);
         }
         MEM_CONTEXT_TEMP_END();
+
+        ioReadClose(read);
     }
     MEM_CONTEXT_TEMP_END();
 
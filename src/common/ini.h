@@ -65,10 +65,10 @@ Helper Functions
 ***********************************************************************************************************************************/
 // Load an ini file and return data to a callback. Intended to read info files that were generated by code so do not have comments
 // or extraneous spaces, and where all values are valid JSON. This allows syntax characters such as [, =, #, and whitespace to be
-// used in keys.
+// used in keys. Values are validated but passed to the callback as JSON strings.
 void iniLoad(
     IoRead *read,
-    void (*callbackFunction)(void *data, const String *section, const String *key, const String *value, const Variant *valueVar),
+    void (*callbackFunction)(void *data, const String *section, const String *key, const String *value),
     void *callbackData);
 
 /***********************************************************************************************************************************
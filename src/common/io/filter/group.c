@@ -12,6 +12,7 @@ IO Filter Group
 #include "common/io/io.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/type/list.h"
 #include "common/type/object.h"
 
@@ -26,6 +27,7 @@ typedef struct IoFilterData
     Buffer *inputLocal;                                             // Non-null if a locally created buffer that can be cleared
     IoFilter *filter;                                               // Filter to apply
     Buffer *output;                                                 // Output buffer for filter
+    TimeUSec time;                                                  // Time spent processing in the filter
 } IoFilterData;
 
 // Macros for logging
@@ -291,9 +293,12 @@ ioFilterGroupProcess(IoFilterGroup *this, const Buffer *input, Buffer *output)
             if (!ioFilterDone(filterData->filter))
             {
                 // If the filter produces output
+                TimeUSec timeBegin = timeUSec();
+
                 if (ioFilterOutput(filterData->filter))
                 {
                     ioFilterProcessInOut(filterData->filter, *filterData->input, filterData->output);
+                    filterData->time += timeUSec() - timeBegin;
 
                     // If inputSame is set then the output buffer for this filter is full and it will need to be re-processed with
                     // the same input once the output buffer is cleared
@@ -312,7 +317,10 @@ ioFilterGroupProcess(IoFilterGroup *this, const Buffer *input, Buffer *output)
                 }
                 // Else the filter does not produce output
                 else
+                {
                     ioFilterProcessIn(filterData->filter, *filterData->input);
+                    filterData->time += timeUSec() - timeBegin;
+                }
             }
 
             // If the filter is done and has no more output then null the output buffer.  Downstream filters have a pointer to this
@@ -377,6 +385,12 @@ ioFilterGroupClose(IoFilterGroup *this)
         MEM_CONTEXT_TEMP_BEGIN()
         {
             kvAdd(this->filterResult, VARSTR(ioFilterType(filterData->filter)), filterResult);
+
+            // Record the processing time for the filter type
+            const String *statKey = strNewFmt(IO_FILTER_STAT_PREFIX "%s", strZ(ioFilterType(filterData->filter)));
+
+            statInc(statKey);
+            statTimeAdd(statKey, filterData->time);
         }
         MEM_CONTEXT_TEMP_END();
     }
@@ -21,6 +21,11 @@ typedef struct IoFilterGroup IoFilterGroup;
 #include "common/io/filter/filter.h"
 #include "common/type/string.h"
 
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+#define IO_FILTER_STAT_PREFIX                                       "filter."           // Prefix for filter processing time
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
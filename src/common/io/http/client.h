@@ -35,7 +35,7 @@ Statistics constants
     STRING_DECLARE(HTTP_STAT_CLIENT_STR);
 #define HTTP_STAT_CLOSE                                             "http.close"        // Closes forced by server
     STRING_DECLARE(HTTP_STAT_CLOSE_STR);
-#define HTTP_STAT_REQUEST                                           "http.request"      // Requests (i.e. calls to httpRequestNew())
+#define HTTP_STAT_REQUEST                                           "http.request"      // Requests and latency until response
     STRING_DECLARE(HTTP_STAT_REQUEST_STR);
 #define HTTP_STAT_RETRY                                             "http.retry"        // Request retries
     STRING_DECLARE(HTTP_STAT_RETRY_STR);
@@ -50,6 +50,7 @@ struct HttpRequest
     const Buffer *content;                                          // HTTP content
 
     HttpSession *session;                                           // Session for async requests
+    TimeUSec timeBegin;                                             // Time the request was started, used for latency stats
 };
 
 OBJECT_DEFINE_MOVE(HTTP_REQUEST);
@@ -210,6 +211,7 @@ httpRequestNew(HttpClient *client, const String *verb, const String *path, HttpR
             .query = httpQueryDupP(param.query),
             .header = param.header == NULL ? httpHeaderNew(NULL) : httpHeaderDup(param.header, NULL),
             .content = param.content == NULL ? NULL : bufDup(param.content),
+            .timeBegin = timeUSec(),
         };
 
         // Send the request
@@ -232,7 +234,12 @@ httpRequestResponse(HttpRequest *this, bool contentCache)
 
     ASSERT(this != NULL);
 
-    FUNCTION_LOG_RETURN(HTTP_RESPONSE, httpRequestProcess(this, true, contentCache));
+    HttpResponse *result = httpRequestProcess(this, true, contentCache);
+
+    // Record latency from when the request was started until the response was received (including retries)
+    statTimeEnd(HTTP_STAT_REQUEST_STR, this->timeBegin);
+
+    FUNCTION_LOG_RETURN(HTTP_RESPONSE, result);
 }
 
 /**********************************************************************************************************************************/
@@ -17,10 +17,89 @@ Stack Trace Handler
 #include "common/stackTrace.h"
 
 /***********************************************************************************************************************************
-Max call stack depth
+Max call stack depth (must be a power of two for the lite stack trace)
 ***********************************************************************************************************************************/
 #define STACK_TRACE_MAX                                             128
 
+/***********************************************************************************************************************************
+Lite stack trace
+
+Only the file and function name are recorded for each function, along with the try depth required to clean the stack after an error.
+Entries are stored in a fixed-size ring indexed by the stack depth so a push or pop is just a few stores with no log level checks or
+parameter buffer handling. If the stack gets deeper than the ring then the oldest entries are overwritten and will be reported as
+not recorded.
+***********************************************************************************************************************************/
+#ifdef STACK_TRACE_LITE
+
+typedef struct StackTraceData
+{
+    const char *fileName;
+    const char *functionName;
+    unsigned int tryDepth;
+} StackTraceData;
+
+static struct StackTraceLocal
+{
+    unsigned int stackSize;                                         // Stack size (may be larger than the ring)
+    StackTraceData stack[STACK_TRACE_MAX];                          // Stack data ring
+    char functionParamBuffer[STACK_TRACE_PARAM_MAX];                // Scratch buffer for parameters (never logged)
+} stackTraceLocal;
+
+#define STACK_TRACE_LITE_IDX(stackIdx)                              ((stackIdx) & (STACK_TRACE_MAX - 1))
+#define STACK_TRACE_LITE_PARAM                                      "lite build - parameters not recorded"
+
+/**********************************************************************************************************************************/
+void
+stackTracePush(const char *fileName, const char *functionName)
+{
+    stackTraceLocal.stack[STACK_TRACE_LITE_IDX(stackTraceLocal.stackSize)] = (StackTraceData)
+    {
+        .fileName = fileName,
+        .functionName = functionName,
+        .tryDepth = errorTryDepth(),
+    };
+
+    stackTraceLocal.stackSize++;
+}
+
+/**********************************************************************************************************************************/
+void
+stackTracePop(void)
+{
+    stackTraceLocal.stackSize--;
+}
+
+/***********************************************************************************************************************************
+Parameters are never recorded in the lite stack trace. These functions are still required to build the parameter logging code in the
+debug macros but that code is never executed.
+***********************************************************************************************************************************/
+const char *
+stackTraceParam(void)
+{
+    return STACK_TRACE_LITE_PARAM;
+}
+
+char *
+stackTraceParamBuffer(const char *paramName)
+{
+    (void)paramName;
+
+    return stackTraceLocal.functionParamBuffer;
+}
+
+void
+stackTraceParamAdd(size_t bufferSize)
+{
+    (void)bufferSize;
+}
+
+void
+stackTraceParamLog(void)
+{
+}
+
+#else // STACK_TRACE_LITE
+
 /***********************************************************************************************************************************
 Local variables
 ***********************************************************************************************************************************/
@@ -285,7 +364,8 @@ stackTracePop(const char *fileName, const char *functionName, bool test)
     }
 }
 
-#endif
+#endif // NDEBUG
+#endif // STACK_TRACE_LITE
 
 /***********************************************************************************************************************************
 Stack trace format
@@ -303,6 +383,49 @@ stackTraceFmt(char *buffer, size_t bufferSize, size_t bufferUsed, const char *fo
 }
 
 /**********************************************************************************************************************************/
+#ifdef STACK_TRACE_LITE
+
+size_t
+stackTraceToZ(char *buffer, size_t bufferSize, const char *fileName, const char *functionName, unsigned int fileLine)
+{
+    unsigned int stackIdx = stackTraceLocal.stackSize;
+    const unsigned int stackMin = stackIdx > STACK_TRACE_MAX ? stackIdx - STACK_TRACE_MAX : 0;
+
+    // Output the current function
+    size_t result = stackTraceFmt(
+        buffer, bufferSize, 0, "%.*s:%s:%u:(%s)", (int)(strlen(fileName) - 2), fileName, functionName, fileLine,
+        STACK_TRACE_LITE_PARAM);
+
+    // Skip the top function on the stack if it is the current function
+    if (stackIdx > 0)
+    {
+        const StackTraceData *data = &stackTraceLocal.stack[STACK_TRACE_LITE_IDX(stackIdx - 1)];
+
+        if (strcmp(fileName, data->fileName) == 0 && strcmp(functionName, data->functionName) == 0)
+            stackIdx--;
+        else
+            result += stackTraceFmt(buffer, bufferSize, result, "\n    ... function(s) omitted ...");
+    }
+
+    // Output the functions that are still in the ring
+    for (; stackIdx > stackMin; stackIdx--)
+    {
+        const StackTraceData *data = &stackTraceLocal.stack[STACK_TRACE_LITE_IDX(stackIdx - 1)];
+
+        result += stackTraceFmt(
+            buffer, bufferSize, result, "\n%.*s:%s:(%s)", (int)(strlen(data->fileName) - 2), data->fileName, data->functionName,
+            STACK_TRACE_LITE_PARAM);
+    }
+
+    // Note functions that were overwritten in the ring
+    if (stackMin > 0)
+        result += stackTraceFmt(buffer, bufferSize, result, "\n    ... %u function(s) not recorded ...", stackMin);
+
+    return result;
+}
+
+#else
+
 size_t
 stackTraceToZ(char *buffer, size_t bufferSize, const char *fileName, const char *functionName, unsigned int fileLine)
 {
@@ -347,10 +470,21 @@ stackTraceToZ(char *buffer, size_t bufferSize, const char *fileName, const char
     return result;
 }
 
+#endif // STACK_TRACE_LITE
+
 /**********************************************************************************************************************************/
 void
 stackTraceClean(unsigned int tryDepth)
 {
+#ifdef STACK_TRACE_LITE
+    while (
+        stackTraceLocal.stackSize > 0 &&
+        stackTraceLocal.stack[STACK_TRACE_LITE_IDX(stackTraceLocal.stackSize - 1)].tryDepth >= tryDepth)
+    {
+        stackTraceLocal.stackSize--;
+    }
+#else
     while (stackTraceLocal.stackSize > 0 && stackTraceLocal.stack[stackTraceLocal.stackSize - 1].tryDepth >= tryDepth)
         stackTraceLocal.stackSize--;
+#endif
 }
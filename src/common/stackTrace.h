@@ -9,6 +9,20 @@ Stack Trace Handler
 
 #include "common/logLevel.h"
 
+/***********************************************************************************************************************************
+The lite stack trace records only file and function names so it is only valid in production builds. Since there is no way to
+capture line numbers it is also not compatible with backtrace.
+***********************************************************************************************************************************/
+#ifdef STACK_TRACE_LITE
+    #ifndef NDEBUG
+        #error "STACK_TRACE_LITE requires NDEBUG"
+    #endif
+
+    #ifdef WITH_BACKTRACE
+        #error "STACK_TRACE_LITE is not compatible with WITH_BACKTRACE"
+    #endif
+#endif
+
 /***********************************************************************************************************************************
 Maximum size of a single parameter (including NULL terminator)
 ***********************************************************************************************************************************/
@@ -17,8 +31,13 @@ Maximum size of a single parameter (including NULL terminator)
 /***********************************************************************************************************************************
 Macros to access internal functions
 ***********************************************************************************************************************************/
-#define STACK_TRACE_PUSH(logLevel)                                                                                                 \
-    stackTracePush(__FILE__, __func__, logLevel)
+#ifdef STACK_TRACE_LITE
+    #define STACK_TRACE_PUSH(logLevel)                                                                                             \
+        stackTracePush(__FILE__, __func__)
+#else
+    #define STACK_TRACE_PUSH(logLevel)                                                                                             \
+        stackTracePush(__FILE__, __func__, logLevel)
+#endif
 
 #ifdef NDEBUG
     #define STACK_TRACE_POP(test)                                                                                                  \
@@ -50,7 +69,11 @@ Internal Functions
 #endif
 
 // Push a new function onto the trace stack
-LogLevel stackTracePush(const char *fileName, const char *functionName, LogLevel functionLogLevel);
+#ifdef STACK_TRACE_LITE
+    void stackTracePush(const char *fileName, const char *functionName);
+#else
+    LogLevel stackTracePush(const char *fileName, const char *functionName, LogLevel functionLogLevel);
+#endif
 
 // Pop a function from the trace stack
 #ifdef NDEBUG
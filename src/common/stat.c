@@ -11,15 +11,29 @@ Statistics Collector
 /***********************************************************************************************************************************
 Stat output constants
 ***********************************************************************************************************************************/
+VARIANT_STRDEF_EXTERN(STAT_VALUE_BYTES_VAR,                         STAT_VALUE_BYTES);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_HISTOGRAM_VAR,                     STAT_VALUE_HISTOGRAM);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_TIME_VAR,                          STAT_VALUE_TIME);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_TIME_MAX_VAR,                      STAT_VALUE_TIME_MAX);
 VARIANT_STRDEF_EXTERN(STAT_VALUE_TOTAL_VAR,                         STAT_VALUE_TOTAL);
 
+/***********************************************************************************************************************************
+Number of histogram buckets. Each bucket is a power of two in milliseconds with the last bucket counting everything that remains,
+which is ~35 minutes and above for 23 buckets.
+***********************************************************************************************************************************/
+#define STAT_HISTOGRAM_SIZE                                         23
+
 /***********************************************************************************************************************************
 Cumulative statistics
 ***********************************************************************************************************************************/
 typedef struct Stat
 {
     const String *key;
-    uint64_t total;
+    uint64_t total;                                                 // Total count
+    uint64_t bytes;                                                 // Total bytes
+    TimeUSec time;                                                  // Total time
+    TimeUSec timeMax;                                               // Maximum single time
+    uint64_t histogram[STAT_HISTOGRAM_SIZE];                        // Time histogram in power of two millisecond buckets
 } Stat;
 
 /***********************************************************************************************************************************
@@ -29,6 +43,7 @@ struct
 {
     MemContext *memContext;                                         // Mem context to store data in this struct
     List *stat;                                                     // Cumulative stats
+    Stat *statLast;                                                 // Last stat found (callers often update a stat repeatedly)
 } statLocalData;
 
 /**********************************************************************************************************************************/
@@ -65,6 +80,10 @@ statGetOrCreate(const String *key)
 
     ASSERT(key != NULL);
 
+    // Check the last stat found before searching the list
+    if (statLocalData.statLast != NULL && strEq(statLocalData.statLast->key, key))
+        FUNCTION_TEST_RETURN(statLocalData.statLast);
+
     // Attempt to find the stat
     Stat *stat = lstFind(statLocalData.stat, &key);
 
@@ -86,6 +105,8 @@ statGetOrCreate(const String *key)
         ASSERT(stat != NULL);
     }
 
+    statLocalData.statLast = stat;
+
     FUNCTION_TEST_RETURN(stat);
 }
 
@@ -105,6 +126,70 @@ statInc(const String *key)
     FUNCTION_TEST_RETURN();
 }
 
+/**********************************************************************************************************************************/
+void
+statBytesAdd(const String *key, uint64_t bytes)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(UINT64, bytes);
+    FUNCTION_TEST_END();
+
+    ASSERT(statLocalData.memContext != NULL);
+    ASSERT(key != NULL);
+
+    statGetOrCreate(key)->bytes += bytes;
+
+    FUNCTION_TEST_RETURN();
+}
+
+/**********************************************************************************************************************************/
+void
+statTimeAdd(const String *key, TimeUSec time)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(UINT64, time);
+    FUNCTION_TEST_END();
+
+    ASSERT(statLocalData.memContext != NULL);
+    ASSERT(key != NULL);
+
+    Stat *stat = statGetOrCreate(key);
+
+    stat->time += time;
+
+    if (time > stat->timeMax)
+        stat->timeMax = time;
+
+    // Find the histogram bucket, i.e. the number of bits required to represent the time in milliseconds
+    unsigned int bucketIdx = 0;
+
+    for (TimeUSec bucketTime = time / USEC_PER_MSEC; bucketTime != 0 && bucketIdx < STAT_HISTOGRAM_SIZE - 1; bucketTime >>= 1)
+        bucketIdx++;
+
+    stat->histogram[bucketIdx]++;
+
+    FUNCTION_TEST_RETURN();
+}
+
+/**********************************************************************************************************************************/
+TimeUSec
+statTimeEnd(const String *key, TimeUSec timeBegin)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(UINT64, timeBegin);
+    FUNCTION_TEST_END();
+
+    TimeUSec result = timeUSec();
+
+    // Guard against clock skew even though the clock is monotonic
+    statTimeAdd(key, result > timeBegin ? result - timeBegin : 0);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 KeyValue *
 statToKv(void)
@@ -120,7 +205,31 @@ statToKv(void)
         Stat *stat = lstGet(statLocalData.stat, statIdx);
 
         KeyValue *statKv = kvPutKv(result, VARSTR(stat->key));
-        kvAdd(statKv, STAT_VALUE_TOTAL_VAR, VARUINT64(stat->total));
+
+        if (stat->total != 0)
+            kvAdd(statKv, STAT_VALUE_TOTAL_VAR, VARUINT64(stat->total));
+
+        if (stat->bytes != 0)
+            kvAdd(statKv, STAT_VALUE_BYTES_VAR, VARUINT64(stat->bytes));
+
+        // Find the last histogram bucket with samples. If there are none then no time was added.
+        unsigned int histogramSize = STAT_HISTOGRAM_SIZE;
+
+        while (histogramSize > 0 && stat->histogram[histogramSize - 1] == 0)
+            histogramSize--;
+
+        if (histogramSize > 0)
+        {
+            kvAdd(statKv, STAT_VALUE_TIME_VAR, VARUINT64(stat->time / USEC_PER_MSEC));
+            kvAdd(statKv, STAT_VALUE_TIME_MAX_VAR, VARUINT64(stat->timeMax / USEC_PER_MSEC));
+
+            VariantList *histogram = varLstNew();
+
+            for (unsigned int bucketIdx = 0; bucketIdx < histogramSize; bucketIdx++)
+                varLstAdd(histogram, varNewUInt64(stat->histogram[bucketIdx]));
+
+            kvAdd(statKv, STAT_VALUE_HISTOGRAM_VAR, varNewVarLst(histogram));
+        }
     }
 
     FUNCTION_TEST_RETURN(result);
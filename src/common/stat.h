@@ -5,6 +5,11 @@ Collect simple statistics that can be output to a KeyValue for processing and lo
 uniquely and will also be used in the output. Individual stats do not need to be created in advance since they will be created as
 needed at runtime. However, statInit() must be called before any other stat*() functions.
 
+In addition to a total, each stat can accumulate elapsed time and bytes processed. Time is reported in milliseconds along with the
+maximum single time and a histogram of times where each element counts the samples that fell into a power of two millisecond bucket,
+i.e. [<1ms, <2ms, <4ms, <8ms, ...]. The histogram is trimmed after the last non-zero bucket. Time and bytes are only reported for
+stats where they have been added, and likewise the total is only reported for stats that have been incremented.
+
 NOTE: Statistics are held in a sorted list so there is some cost involved in each lookup. In general, statistics should be used for
 relatively important or high-latency operations where measurements are critical. For instance, using statistics to count the
 iterations of a loop would likely be a bad idea.
@@ -12,11 +17,20 @@ iterations of a loop would likely be a bad idea.
 #ifndef COMMON_STAT_H
 #define COMMON_STAT_H
 
+#include "common/time.h"
 #include "common/type/variant.h"
 
 /***********************************************************************************************************************************
 Statistics output constants
 ***********************************************************************************************************************************/
+#define STAT_VALUE_BYTES                                            "bytes"
+    VARIANT_DECLARE(STAT_VALUE_BYTES_VAR);
+#define STAT_VALUE_HISTOGRAM                                        "histogram"
+    VARIANT_DECLARE(STAT_VALUE_HISTOGRAM_VAR);
+#define STAT_VALUE_TIME                                             "time"
+    VARIANT_DECLARE(STAT_VALUE_TIME_VAR);
+#define STAT_VALUE_TIME_MAX                                         "timeMax"
+    VARIANT_DECLARE(STAT_VALUE_TIME_MAX_VAR);
 #define STAT_VALUE_TOTAL                                            "total"
     VARIANT_DECLARE(STAT_VALUE_TOTAL_VAR);
 
@@ -29,6 +43,15 @@ void statInit(void);
 // Increment stat by one
 void statInc(const String *key);
 
+// Add bytes processed to stat
+void statBytesAdd(const String *key, uint64_t bytes);
+
+// Add elapsed time (in microseconds) to stat
+void statTimeAdd(const String *key, TimeUSec time);
+
+// Add time elapsed since timeBegin to stat and return the current time, which is convenient for timing consecutive phases
+TimeUSec statTimeEnd(const String *key, TimeUSec timeBegin);
+
 // Output stats to a KeyValue
 KeyValue *statToKv(void);
 
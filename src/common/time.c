@@ -26,6 +26,18 @@ timeMSec(void)
     FUNCTION_TEST_RETURN(((TimeMSec)currentTime.tv_sec * MSEC_PER_SEC) + (TimeMSec)currentTime.tv_usec / MSEC_PER_USEC);
 }
 
+/**********************************************************************************************************************************/
+TimeUSec
+timeUSec(void)
+{
+    FUNCTION_TEST_VOID();
+
+    struct timespec currentTime;
+    clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+    FUNCTION_TEST_RETURN(((TimeUSec)currentTime.tv_sec * USEC_PER_SEC) + (TimeUSec)currentTime.tv_nsec / 1000);
+}
+
 /**********************************************************************************************************************************/
 void
 sleepMSec(TimeMSec sleepMSec)
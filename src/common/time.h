@@ -11,11 +11,14 @@ Time Management
 Time types
 ***********************************************************************************************************************************/
 typedef uint64_t TimeMSec;
+typedef uint64_t TimeUSec;
 
 /***********************************************************************************************************************************
 Constants describing number of sub-units in an interval
 ***********************************************************************************************************************************/
 #define MSEC_PER_SEC                                                ((TimeMSec)1000)
+#define USEC_PER_MSEC                                               ((TimeUSec)1000)
+#define USEC_PER_SEC                                                ((TimeUSec)1000000)
 #define SEC_PER_DAY                                                 ((time_t)86400)
 
 /***********************************************************************************************************************************
@@ -27,6 +30,9 @@ void sleepMSec(TimeMSec sleepMSec);
 // Epoch time in milliseconds
 TimeMSec timeMSec(void);
 
+// Monotonic time in microseconds. Only useful for measuring intervals since the starting point is arbitrary.
+TimeUSec timeUSec(void);
+
 // Are the date parts valid? (year >= 1970, month 1-12, day 1-31)
 void datePartsValid(int year, int month, int day);
 
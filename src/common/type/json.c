@@ -4,11 +4,13 @@ Convert JSON to/from KeyValue
 #include "build.auto.h"
 
 #include <ctype.h>
+#include <limits.h>
 #include <string.h>
 
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/type/json.h"
+#include "common/type/object.h"
 
 /***********************************************************************************************************************************
 Prototypes
@@ -596,6 +598,726 @@ jsonToVar(const String *json)
     FUNCTION_LOG_RETURN(VARIANT, result);
 }
 
+/***********************************************************************************************************************************
+Pull-style reader
+***********************************************************************************************************************************/
+// Maximum container depth. Each level is tracked as a bit so no allocation is needed for the container stack.
+#define JSON_READ_DEPTH_MAX                                         64
+
+struct JsonRead
+{
+    MemContext *memContext;                                         // Mem context
+    const char *json;                                               // JSON to read
+    unsigned int jsonPos;                                           // Current position in the JSON
+    unsigned int depth;                                             // Current container depth
+    uint64_t objectStack;                                           // Bit is set when the container at that depth is an object
+    bool first;                                                     // Next item is the first in the container
+    bool comma;                                                     // Comma was found after the last item
+    bool key;                                                       // Key was read so a value is next
+};
+
+OBJECT_DEFINE_FREE(JSON_READ);
+
+// Is the current container an object?
+static bool
+jsonReadObject(const JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(this->depth > 0 && (this->objectStack >> (this->depth - 1)) & 1);
+}
+
+// Check that a key or value may be read at the current position
+static void
+jsonReadItemBegin(JsonRead *this, bool key)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+        FUNCTION_TEST_PARAM(BOOL, key);
+    FUNCTION_TEST_END();
+
+    ASSERT(!key || (jsonReadObject(this) && !this->key));
+
+    if (this->depth > 0)
+    {
+        // A value in an object must be preceded by a key
+        if (!key && !this->key && jsonReadObject(this))
+            THROW_FMT(JsonFormatError, "expected key at '%s'", this->json + this->jsonPos);
+
+        // Items after the first must be preceded by a comma
+        if (!this->key && !this->first && !this->comma)
+            THROW_FMT(JsonFormatError, "expected ',' at '%s'", this->json + this->jsonPos);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Consume the whitespace and comma after an item
+static void
+jsonReadItemEnd(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    this->first = false;
+    this->comma = false;
+    this->key = false;
+
+    jsonConsumeWhiteSpace(this->json, &this->jsonPos);
+
+    if (this->depth == 0)
+    {
+        if (this->json[this->jsonPos] != '\0')
+            THROW_FMT(JsonFormatError, "unexpected characters after JSON at '%s'", this->json + this->jsonPos);
+    }
+    else if (this->json[this->jsonPos] == ',')
+    {
+        this->jsonPos++;
+        this->comma = true;
+
+        jsonConsumeWhiteSpace(this->json, &this->jsonPos);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Skip a string without decoding it. Escapes are validated so the result matches jsonToStr().
+static void
+jsonReadStrSkip(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    const char *const json = this->json;
+
+    if (json[this->jsonPos] != '"')
+        THROW_FMT(JsonFormatError, "expected '\"' at '%s'", json + this->jsonPos);
+
+    this->jsonPos++;
+
+    while (json[this->jsonPos] != '"')
+    {
+        if (json[this->jsonPos] == '\0')
+            THROW(JsonFormatError, "expected '\"' but found null delimiter");
+
+        if (json[this->jsonPos] == '\\')
+        {
+            this->jsonPos++;
+
+            switch (json[this->jsonPos])
+            {
+                case '"':
+                case '\\':
+                case '/':
+                case 'n':
+                case 'r':
+                case 't':
+                case 'b':
+                case 'f':
+                    break;
+
+                case 'u':
+                {
+                    if (strncmp(json + this->jsonPos + 1, "00", 2) != 0 || !isxdigit(json[this->jsonPos + 3]) ||
+                        !isxdigit(json[this->jsonPos + 4]))
+                    {
+                        THROW_FMT(JsonFormatError, "unable to decode '%.4s'", json + this->jsonPos + 1);
+                    }
+
+                    this->jsonPos += 4;
+                    break;
+                }
+
+                default:
+                    THROW_FMT(JsonFormatError, "invalid escape character '%c'", json[this->jsonPos]);
+            }
+        }
+
+        this->jsonPos++;
+    }
+
+    this->jsonPos++;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Read a number directly from the JSON so no intermediate String or Variant is needed
+static uint64_t
+jsonReadNumberInternal(JsonRead *this, bool *negative)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+        FUNCTION_TEST_PARAM_P(BOOL, negative);
+    FUNCTION_TEST_END();
+
+    const char *const json = this->json;
+    const unsigned int jsonPosBegin = this->jsonPos;
+    uint64_t result = 0;
+
+    *negative = json[this->jsonPos] == '-';
+
+    if (*negative)
+        this->jsonPos++;
+
+    if (!isdigit(json[this->jsonPos]))
+        THROW_FMT(JsonFormatError, "expected number at '%s'", json + jsonPosBegin);
+
+    while (isdigit(json[this->jsonPos]))
+    {
+        const uint64_t digit = (uint64_t)(json[this->jsonPos] - '0');
+
+        if (result > (UINT64_MAX - digit) / 10)
+            THROW_FMT(JsonFormatError, "number is out of range at '%s'", json + jsonPosBegin);
+
+        result = result * 10 + digit;
+        this->jsonPos++;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+JsonRead *
+jsonReadNew(const String *json)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, json);
+    FUNCTION_TEST_END();
+
+    ASSERT(json != NULL);
+
+    JsonRead *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("JsonRead")
+    {
+        this = memNew(sizeof(JsonRead));
+
+        *this = (JsonRead)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .json = strZ(json),
+        };
+
+        jsonConsumeWhiteSpace(this->json, &this->jsonPos);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/**********************************************************************************************************************************/
+JsonType
+jsonReadTypeNext(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    JsonType result = jsonTypeNull;
+
+    switch (this->json[this->jsonPos])
+    {
+        case '"':
+            result = jsonTypeString;
+            break;
+
+        case '-':
+        case '0' ... '9':
+            result = jsonTypeNumber;
+            break;
+
+        case 't':
+        case 'f':
+            result = jsonTypeBool;
+            break;
+
+        case 'n':
+            break;
+
+        case '[':
+            result = jsonTypeArrayBegin;
+            break;
+
+        case ']':
+            result = jsonTypeArrayEnd;
+            break;
+
+        case '{':
+            result = jsonTypeObjectBegin;
+            break;
+
+        case '}':
+            result = jsonTypeObjectEnd;
+            break;
+
+        case '\0':
+            THROW(JsonFormatError, "expected data");
+
+        default:
+            THROW_FMT(JsonFormatError, "invalid type at '%s'", this->json + this->jsonPos);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+// Helpers to begin/end containers
+static void
+jsonReadContainerBegin(JsonRead *this, bool object)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+        FUNCTION_TEST_PARAM(BOOL, object);
+    FUNCTION_TEST_END();
+
+    const char open = object ? '{' : '[';
+
+    jsonReadItemBegin(this, false);
+
+    if (this->json[this->jsonPos] != open)
+        THROW_FMT(JsonFormatError, "expected '%c' at '%s'", open, this->json + this->jsonPos);
+
+    if (this->depth == JSON_READ_DEPTH_MAX)
+        THROW_FMT(JsonFormatError, "nesting is deeper than %d levels", JSON_READ_DEPTH_MAX);
+
+    this->jsonPos++;
+    this->depth++;
+
+    if (object)
+        this->objectStack |= (uint64_t)1 << (this->depth - 1);
+    else
+        this->objectStack &= ~((uint64_t)1 << (this->depth - 1));
+
+    this->first = true;
+    this->comma = false;
+    this->key = false;
+
+    jsonConsumeWhiteSpace(this->json, &this->jsonPos);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static void
+jsonReadContainerEnd(JsonRead *this, bool object)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+        FUNCTION_TEST_PARAM(BOOL, object);
+    FUNCTION_TEST_END();
+
+    ASSERT(this->depth > 0);
+    ASSERT(jsonReadObject(this) == object);
+
+    const char close = object ? '}' : ']';
+
+    // A key without a value or a trailing comma is an error
+    if (this->key || this->comma)
+    {
+        THROW_FMT(
+            JsonFormatError, "expected %s at '%s'", this->key || !object ? "value" : "key", this->json + this->jsonPos);
+    }
+
+    if (this->json[this->jsonPos] != close)
+        THROW_FMT(JsonFormatError, "expected '%c' at '%s'", close, this->json + this->jsonPos);
+
+    this->jsonPos++;
+    this->depth--;
+
+    jsonReadItemEnd(this);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+jsonReadArrayBegin(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadContainerBegin(this, false);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+jsonReadArrayEnd(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadContainerEnd(this, false);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+jsonReadObjectBegin(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadContainerBegin(this, true);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+jsonReadObjectEnd(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadContainerEnd(this, true);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+// Consume the : after a key
+static void
+jsonReadKeyEnd(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    jsonConsumeWhiteSpace(this->json, &this->jsonPos);
+
+    if (this->json[this->jsonPos] != ':')
+        THROW_FMT(JsonFormatError, "expected ':' at '%s'", this->json + this->jsonPos);
+
+    this->jsonPos++;
+    this->key = true;
+
+    jsonConsumeWhiteSpace(this->json, &this->jsonPos);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+String *
+jsonReadKey(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadItemBegin(this, true);
+
+    String *result = jsonToStrInternal(this->json, &this->jsonPos);
+
+    jsonReadKeyEnd(this);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+bool
+jsonReadKeyMatchZ(JsonRead *this, const char *key)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+        FUNCTION_TEST_PARAM(STRINGZ, key);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(key != NULL);
+
+    jsonReadItemBegin(this, true);
+
+    const char *const json = this->json + this->jsonPos;
+    const size_t keySize = strlen(key);
+
+    if (json[0] != '"')
+        THROW_FMT(JsonFormatError, "expected '\"' at '%s'", json);
+
+    // Compare the raw key so nothing needs to be decoded or allocated
+    if (strncmp(json + 1, key, keySize) != 0 || json[keySize + 1] != '"')
+        FUNCTION_TEST_RETURN(false);
+
+    this->jsonPos += (unsigned int)keySize + 2;
+    jsonReadKeyEnd(this);
+
+    FUNCTION_TEST_RETURN(true);
+}
+
+/**********************************************************************************************************************************/
+bool
+jsonReadBool(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadItemBegin(this, false);
+
+    const bool result = jsonToBoolInternal(this->json, &this->jsonPos);
+
+    jsonReadItemEnd(this);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+int
+jsonReadInt(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    const char *const json = this->json + this->jsonPos;
+    const int64_t result = jsonReadInt64(this);
+
+    if (result < INT_MIN || result > INT_MAX)
+        THROW_FMT(JsonFormatError, "number is out of range at '%s'", json);
+
+    FUNCTION_TEST_RETURN((int)result);
+}
+
+int64_t
+jsonReadInt64(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadItemBegin(this, false);
+
+    const char *const json = this->json + this->jsonPos;
+    bool negative;
+    const uint64_t number = jsonReadNumberInternal(this, &negative);
+
+    if (number > (uint64_t)INT64_MAX + (negative ? 1 : 0))
+        THROW_FMT(JsonFormatError, "number is out of range at '%s'", json);
+
+    jsonReadItemEnd(this);
+
+    FUNCTION_TEST_RETURN(negative ? (int64_t)(0 - number) : (int64_t)number);
+}
+
+unsigned int
+jsonReadUInt(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    const char *const json = this->json + this->jsonPos;
+    const uint64_t result = jsonReadUInt64(this);
+
+    if (result > UINT_MAX)
+        THROW_FMT(JsonFormatError, "number is out of range at '%s'", json);
+
+    FUNCTION_TEST_RETURN((unsigned int)result);
+}
+
+uint64_t
+jsonReadUInt64(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadItemBegin(this, false);
+
+    const char *const json = this->json + this->jsonPos;
+    bool negative;
+    const uint64_t result = jsonReadNumberInternal(this, &negative);
+
+    if (negative)
+        THROW_FMT(JsonFormatError, "expected unsigned number at '%s'", json);
+
+    jsonReadItemEnd(this);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+jsonReadNull(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadItemBegin(this, false);
+
+    if (strncmp(this->json + this->jsonPos, NULL_Z, 4) != 0)
+        THROW_FMT(JsonFormatError, "expected null at '%s'", this->json + this->jsonPos);
+
+    this->jsonPos += 4;
+
+    jsonReadItemEnd(this);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+String *
+jsonReadStr(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    String *result = NULL;
+
+    if (jsonReadTypeNext(this) == jsonTypeNull)
+        jsonReadNull(this);
+    else
+    {
+        jsonReadItemBegin(this, false);
+        result = jsonToStrInternal(this->json, &this->jsonPos);
+        jsonReadItemEnd(this);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+Variant *
+jsonReadVar(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    jsonReadItemBegin(this, false);
+
+    Variant *result = jsonToVarInternal(this->json, &this->jsonPos);
+
+    jsonReadItemEnd(this);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+jsonReadSkip(JsonRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    // Skip the key if it has not been read
+    if (jsonReadObject(this) && !this->key)
+    {
+        jsonReadItemBegin(this, true);
+        jsonReadStrSkip(this);
+        jsonReadKeyEnd(this);
+    }
+
+    switch (jsonReadTypeNext(this))
+    {
+        case jsonTypeBool:
+            jsonReadBool(this);
+            break;
+
+        case jsonTypeNull:
+            jsonReadNull(this);
+            break;
+
+        case jsonTypeNumber:
+        {
+            bool negative;
+
+            jsonReadItemBegin(this, false);
+            jsonReadNumberInternal(this, &negative);
+            jsonReadItemEnd(this);
+            break;
+        }
+
+        case jsonTypeString:
+            jsonReadItemBegin(this, false);
+            jsonReadStrSkip(this);
+            jsonReadItemEnd(this);
+            break;
+
+        case jsonTypeArrayBegin:
+        {
+            jsonReadArrayBegin(this);
+
+            while (jsonReadTypeNext(this) != jsonTypeArrayEnd)
+                jsonReadSkip(this);
+
+            jsonReadArrayEnd(this);
+            break;
+        }
+
+        case jsonTypeObjectBegin:
+        {
+            jsonReadObjectBegin(this);
+
+            while (jsonReadTypeNext(this) != jsonTypeObjectEnd)
+                jsonReadSkip(this);
+
+            jsonReadObjectEnd(this);
+            break;
+        }
+
+        default:
+            THROW_FMT(JsonFormatError, "expected value at '%s'", this->json + this->jsonPos);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+jsonValidate(const String *json)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, json);
+    FUNCTION_TEST_END();
+
+    ASSERT(json != NULL);
+
+    // The reader is on the stack so validation does not allocate at all
+    JsonRead read = {.json = strZ(json)};
+
+    jsonConsumeWhiteSpace(read.json, &read.jsonPos);
+    jsonReadSkip(&read);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 const String *
 jsonFromBool(bool value)
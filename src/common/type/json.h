@@ -4,8 +4,31 @@ Convert JSON to/from KeyValue
 #ifndef COMMON_TYPE_JSON_H
 #define COMMON_TYPE_JSON_H
 
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define JSON_READ_TYPE                                              JsonRead
+#define JSON_READ_PREFIX                                            jsonRead
+
+typedef struct JsonRead JsonRead;
+
 #include "common/type/keyValue.h"
 
+/***********************************************************************************************************************************
+JSON types returned by jsonReadTypeNext()
+***********************************************************************************************************************************/
+typedef enum
+{
+    jsonTypeBool,                                                   // Boolean
+    jsonTypeNull,                                                   // Null
+    jsonTypeNumber,                                                 // Integer number
+    jsonTypeString,                                                 // String
+    jsonTypeArrayBegin,                                             // Beginning of an array
+    jsonTypeArrayEnd,                                               // End of an array
+    jsonTypeObjectBegin,                                            // Beginning of an object
+    jsonTypeObjectEnd,                                              // End of an object
+} JsonType;
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -30,6 +53,57 @@ Variant *jsonToVar(const String *json);
 // Convert a json array to a VariantList
 VariantList *jsonToVarLst(const String *json);
 
+// Validate JSON without building a Variant. JsonFormatError is thrown if the JSON is not valid.
+void jsonValidate(const String *json);
+
+/***********************************************************************************************************************************
+Pull-style reader
+
+Reads JSON in place, one key or value at a time, without building intermediate Variant/KeyValue trees. This is much cheaper than
+jsonToVar() when only some of the values are needed or the values are immediately copied into a struct. The JSON string is not
+copied so it must not be freed or modified while the reader is in use.
+***********************************************************************************************************************************/
+JsonRead *jsonReadNew(const String *json);
+
+// Type of the next key or value
+JsonType jsonReadTypeNext(JsonRead *this);
+
+// Begin/end an array
+void jsonReadArrayBegin(JsonRead *this);
+void jsonReadArrayEnd(JsonRead *this);
+
+// Begin/end an object
+void jsonReadObjectBegin(JsonRead *this);
+void jsonReadObjectEnd(JsonRead *this);
+
+// Read the next key in an object
+String *jsonReadKey(JsonRead *this);
+
+// If the next key matches then read it and return true, else leave it to be read later. The comparison is done on the raw JSON so
+// the key must not contain characters that need to be escaped.
+bool jsonReadKeyMatchZ(JsonRead *this, const char *key);
+
+// Read values
+bool jsonReadBool(JsonRead *this);
+int jsonReadInt(JsonRead *this);
+int64_t jsonReadInt64(JsonRead *this);
+void jsonReadNull(JsonRead *this);
+String *jsonReadStr(JsonRead *this);                                // Returns NULL when the value is null
+unsigned int jsonReadUInt(JsonRead *this);
+uint64_t jsonReadUInt64(JsonRead *this);
+
+// Read the next value (of any type) as a Variant
+Variant *jsonReadVar(JsonRead *this);
+
+// Skip the next value, including nested values. In an object the key is also skipped if it has not been read.
+void jsonReadSkip(JsonRead *this);
+
+// Free the reader
+void jsonReadFree(JsonRead *this);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
 // Convert a boolean to JSON
 const String *jsonFromBool(bool value);
 
@@ -48,4 +122,12 @@ String *jsonFromStr(const String *string);
 // Convert Variant to JSON
 String *jsonFromVar(const Variant *var);
 
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_JSON_READ_TYPE                                                                                                \
+    JsonRead *
+#define FUNCTION_LOG_JSON_READ_FORMAT(value, buffer, bufferSize)                                                                   \
+    objToLog(value, "JsonRead", buffer, bufferSize)
+
 #endif
@@ -9,8 +9,19 @@ System User/Group Management
 
 #include "common/debug.h"
 #include "common/memContext.h"
+#include "common/type/list.h"
 #include "common/user.h"
 
+/***********************************************************************************************************************************
+Cached user/group name. Name lookups can be expensive (e.g. NSS backed by LDAP) and there are generally only a few distinct owners
+in a directory tree, so caching names avoids a lookup per file when building file lists.
+***********************************************************************************************************************************/
+typedef struct UserNameCache
+{
+    unsigned int id;                                                // User/group id
+    const String *name;                                             // User/group name (NULL if there is no mapping)
+} UserNameCache;
+
 /***********************************************************************************************************************************
 User group info
 ***********************************************************************************************************************************/
@@ -24,8 +35,31 @@ struct
 
     gid_t groupId;                                                  // Real group id of the calling process from getgid()
     const String *groupName;                                        // Group name if it exists
+
+    List *userNameCache;                                            // Cache of user names by id
+    List *groupNameCache;                                           // Cache of group names by id
 } userLocalData;
 
+/***********************************************************************************************************************************
+Compare cached names by id
+***********************************************************************************************************************************/
+static int
+userNameCacheComparator(const void *item1, const void *item2)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, item1);
+        FUNCTION_TEST_PARAM_P(VOID, item2);
+    FUNCTION_TEST_END();
+
+    ASSERT(item1 != NULL);
+    ASSERT(item2 != NULL);
+
+    const unsigned int id1 = ((const UserNameCache *)item1)->id;
+    const unsigned int id2 = ((const UserNameCache *)item2)->id;
+
+    FUNCTION_TEST_RETURN(id1 < id2 ? -1 : id1 > id2 ? 1 : 0);
+}
+
 /**********************************************************************************************************************************/
 static void
 userInitInternal(void)
@@ -44,6 +78,9 @@ userInitInternal(void)
 
             userLocalData.groupId = getgid();
             userLocalData.groupName = groupNameFromId(userLocalData.groupId);
+
+            userLocalData.userNameCache = lstNewP(sizeof(UserNameCache), .comparator = userNameCacheComparator);
+            userLocalData.groupNameCache = lstNewP(sizeof(UserNameCache), .comparator = userNameCacheComparator);
         }
         MEM_CONTEXT_NEW_END();
     }
@@ -114,6 +151,32 @@ groupNameFromId(gid_t groupId)
     FUNCTION_TEST_RETURN(NULL);
 }
 
+/**********************************************************************************************************************************/
+const String *
+groupNameFromIdCache(gid_t groupId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, groupId);
+    FUNCTION_TEST_END();
+
+    ASSERT(userLocalData.memContext != NULL);
+
+    const UserNameCache *groupName = lstFind(userLocalData.groupNameCache, &(UserNameCache){.id = groupId});
+
+    // If not found then lookup the name and add it to the cache
+    if (groupName == NULL)
+    {
+        MEM_CONTEXT_BEGIN(lstMemContext(userLocalData.groupNameCache))
+        {
+            groupName = lstAdd(
+                userLocalData.groupNameCache, &(UserNameCache){.id = groupId, .name = groupNameFromId(groupId)});
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN(groupName->name);
+}
+
 /**********************************************************************************************************************************/
 uid_t
 userId(void)
@@ -165,6 +228,31 @@ userNameFromId(uid_t userId)
     FUNCTION_TEST_RETURN(NULL);
 }
 
+/**********************************************************************************************************************************/
+const String *
+userNameFromIdCache(uid_t userId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, userId);
+    FUNCTION_TEST_END();
+
+    ASSERT(userLocalData.memContext != NULL);
+
+    const UserNameCache *userName = lstFind(userLocalData.userNameCache, &(UserNameCache){.id = userId});
+
+    // If not found then lookup the name and add it to the cache
+    if (userName == NULL)
+    {
+        MEM_CONTEXT_BEGIN(lstMemContext(userLocalData.userNameCache))
+        {
+            userName = lstAdd(userLocalData.userNameCache, &(UserNameCache){.id = userId, .name = userNameFromId(userId)});
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN(userName->name);
+}
+
 /**********************************************************************************************************************************/
 bool
 userRoot(void)
@@ -26,6 +26,10 @@ const String *groupName(void);
 // Get the group name from a group id.  Returns NULL if the group id is invalid or there is no mapping.
 String *groupNameFromId(gid_t groupId);
 
+// Get the group name from a group id and cache the result for the life of the process. Returns NULL if the group id is invalid or
+// there is no mapping.
+const String *groupNameFromIdCache(gid_t groupId);
+
 // Get the id of the current user
 uid_t userId(void);
 
@@ -38,6 +42,10 @@ const String *userName(void);
 // Get the user name from a user id.  Returns NULL if the user id is invalid or there is no mapping.
 String *userNameFromId(uid_t userId);
 
+// Get the user name from a user id and cache the result for the life of the process. Returns NULL if the user id is invalid or
+// there is no mapping.
+const String *userNameFromIdCache(uid_t userId);
+
 // Is the current user the root user?
 bool userRoot(void);
 
@@ -263,15 +263,19 @@ STRING_EXTERN(CFGOPT_ARCHIVE_COPY_STR,                              CFGOPT_ARCHI
 STRING_EXTERN(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR,                     CFGOPT_ARCHIVE_GET_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_MODE_STR,                              CFGOPT_ARCHIVE_MODE);
 STRING_EXTERN(CFGOPT_ARCHIVE_MODE_CHECK_STR,                        CFGOPT_ARCHIVE_MODE_CHECK);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_AHEAD_STR,                        CFGOPT_ARCHIVE_PUSH_AHEAD);
 STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR,                    CFGOPT_ARCHIVE_PUSH_QUEUE_MAX);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_TRIM_STR,                         CFGOPT_ARCHIVE_PUSH_TRIM);
 STRING_EXTERN(CFGOPT_ARCHIVE_TIMEOUT_STR,                           CFGOPT_ARCHIVE_TIMEOUT);
 STRING_EXTERN(CFGOPT_BACKUP_STANDBY_STR,                            CFGOPT_BACKUP_STANDBY);
 STRING_EXTERN(CFGOPT_BUFFER_SIZE_STR,                               CFGOPT_BUFFER_SIZE);
+STRING_EXTERN(CFGOPT_CHECKSUM_BLOCK_STR,                            CFGOPT_CHECKSUM_BLOCK);
 STRING_EXTERN(CFGOPT_CHECKSUM_PAGE_STR,                             CFGOPT_CHECKSUM_PAGE);
 STRING_EXTERN(CFGOPT_CIPHER_PASS_STR,                               CFGOPT_CIPHER_PASS);
 STRING_EXTERN(CFGOPT_CMD_SSH_STR,                                   CFGOPT_CMD_SSH);
 STRING_EXTERN(CFGOPT_COMPRESS_STR,                                  CFGOPT_COMPRESS);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_STR,                            CFGOPT_COMPRESS_LEVEL);
+STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_ADAPTIVE_STR,                   CFGOPT_COMPRESS_LEVEL_ADAPTIVE);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_NETWORK_STR,                    CFGOPT_COMPRESS_LEVEL_NETWORK);
 STRING_EXTERN(CFGOPT_COMPRESS_TYPE_STR,                             CFGOPT_COMPRESS_TYPE);
 STRING_EXTERN(CFGOPT_CONFIG_STR,                                    CFGOPT_CONFIG);
@@ -279,6 +283,7 @@ STRING_EXTERN(CFGOPT_CONFIG_INCLUDE_PATH_STR,                       CFGOPT_CONFI
 STRING_EXTERN(CFGOPT_CONFIG_PATH_STR,                               CFGOPT_CONFIG_PATH);
 STRING_EXTERN(CFGOPT_DB_INCLUDE_STR,                                CFGOPT_DB_INCLUDE);
 STRING_EXTERN(CFGOPT_DB_TIMEOUT_STR,                                CFGOPT_DB_TIMEOUT);
+STRING_EXTERN(CFGOPT_DECODE_HOST_STR,                               CFGOPT_DECODE_HOST);
 STRING_EXTERN(CFGOPT_DELTA_STR,                                     CFGOPT_DELTA);
 STRING_EXTERN(CFGOPT_DRY_RUN_STR,                                   CFGOPT_DRY_RUN);
 STRING_EXTERN(CFGOPT_EXCLUDE_STR,                                   CFGOPT_EXCLUDE);
@@ -321,6 +326,7 @@ STRING_EXTERN(CFGOPT_SPOOL_PATH_STR,                                CFGOPT_SPOOL
 STRING_EXTERN(CFGOPT_STANZA_STR,                                    CFGOPT_STANZA);
 STRING_EXTERN(CFGOPT_START_FAST_STR,                                CFGOPT_START_FAST);
 STRING_EXTERN(CFGOPT_STOP_AUTO_STR,                                 CFGOPT_STOP_AUTO);
+STRING_EXTERN(CFGOPT_SYNC_DEFER_STR,                                CFGOPT_SYNC_DEFER);
 STRING_EXTERN(CFGOPT_TABLESPACE_MAP_STR,                            CFGOPT_TABLESPACE_MAP);
 STRING_EXTERN(CFGOPT_TABLESPACE_MAP_ALL_STR,                        CFGOPT_TABLESPACE_MAP_ALL);
 STRING_EXTERN(CFGOPT_TARGET_STR,                                    CFGOPT_TARGET);
@@ -72,14 +72,20 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_MODE_STR);
 #define CFGOPT_ARCHIVE_MODE_CHECK                                   "archive-mode-check"
     STRING_DECLARE(CFGOPT_ARCHIVE_MODE_CHECK_STR);
+#define CFGOPT_ARCHIVE_PUSH_AHEAD                                   "archive-push-ahead"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_AHEAD_STR);
 #define CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                               "archive-push-queue-max"
     STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR);
+#define CFGOPT_ARCHIVE_PUSH_TRIM                                    "archive-push-trim"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_TRIM_STR);
 #define CFGOPT_ARCHIVE_TIMEOUT                                      "archive-timeout"
     STRING_DECLARE(CFGOPT_ARCHIVE_TIMEOUT_STR);
 #define CFGOPT_BACKUP_STANDBY                                       "backup-standby"
     STRING_DECLARE(CFGOPT_BACKUP_STANDBY_STR);
 #define CFGOPT_BUFFER_SIZE                                          "buffer-size"
     STRING_DECLARE(CFGOPT_BUFFER_SIZE_STR);
+#define CFGOPT_CHECKSUM_BLOCK                                       "checksum-block"
+    STRING_DECLARE(CFGOPT_CHECKSUM_BLOCK_STR);
 #define CFGOPT_CHECKSUM_PAGE                                        "checksum-page"
     STRING_DECLARE(CFGOPT_CHECKSUM_PAGE_STR);
 #define CFGOPT_CIPHER_PASS                                          "cipher-pass"
@@ -90,6 +96,8 @@ Option constants
     STRING_DECLARE(CFGOPT_COMPRESS_STR);
 #define CFGOPT_COMPRESS_LEVEL                                       "compress-level"
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_STR);
+#define CFGOPT_COMPRESS_LEVEL_ADAPTIVE                              "compress-level-adaptive"
+    STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_ADAPTIVE_STR);
 #define CFGOPT_COMPRESS_LEVEL_NETWORK                               "compress-level-network"
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_NETWORK_STR);
 #define CFGOPT_COMPRESS_TYPE                                        "compress-type"
@@ -104,6 +112,8 @@ Option constants
     STRING_DECLARE(CFGOPT_DB_INCLUDE_STR);
 #define CFGOPT_DB_TIMEOUT                                           "db-timeout"
     STRING_DECLARE(CFGOPT_DB_TIMEOUT_STR);
+#define CFGOPT_DECODE_HOST                                          "decode-host"
+    STRING_DECLARE(CFGOPT_DECODE_HOST_STR);
 #define CFGOPT_DELTA                                                "delta"
     STRING_DECLARE(CFGOPT_DELTA_STR);
 #define CFGOPT_DRY_RUN                                              "dry-run"
@@ -188,6 +198,8 @@ Option constants
     STRING_DECLARE(CFGOPT_START_FAST_STR);
 #define CFGOPT_STOP_AUTO                                            "stop-auto"
     STRING_DECLARE(CFGOPT_STOP_AUTO_STR);
+#define CFGOPT_SYNC_DEFER                                           "sync-defer"
+    STRING_DECLARE(CFGOPT_SYNC_DEFER_STR);
 #define CFGOPT_TABLESPACE_MAP                                       "tablespace-map"
     STRING_DECLARE(CFGOPT_TABLESPACE_MAP_STR);
 #define CFGOPT_TABLESPACE_MAP_ALL                                   "tablespace-map-all"
@@ -209,7 +221,7 @@ Option constants
 #define CFGOPT_TYPE                                                 "type"
     STRING_DECLARE(CFGOPT_TYPE_STR);
 
-#define CFG_OPTION_TOTAL                                            129
+#define CFG_OPTION_TOTAL                                            135
 
 /***********************************************************************************************************************************
 Command enum
@@ -259,15 +271,19 @@ typedef enum
     cfgOptArchiveGetQueueMax,
     cfgOptArchiveMode,
     cfgOptArchiveModeCheck,
+    cfgOptArchivePushAhead,
     cfgOptArchivePushQueueMax,
+    cfgOptArchivePushTrim,
     cfgOptArchiveTimeout,
     cfgOptBackupStandby,
     cfgOptBufferSize,
+    cfgOptChecksumBlock,
     cfgOptChecksumPage,
     cfgOptCipherPass,
     cfgOptCmdSsh,
     cfgOptCompress,
     cfgOptCompressLevel,
+    cfgOptCompressLevelAdaptive,
     cfgOptCompressLevelNetwork,
     cfgOptCompressType,
     cfgOptConfig,
@@ -275,6 +291,7 @@ typedef enum
     cfgOptConfigPath,
     cfgOptDbInclude,
     cfgOptDbTimeout,
+    cfgOptDecodeHost,
     cfgOptDelta,
     cfgOptDryRun,
     cfgOptExclude,
@@ -372,6 +389,7 @@ typedef enum
     cfgOptStanza,
     cfgOptStartFast,
     cfgOptStopAuto,
+    cfgOptSyncDefer,
     cfgOptTablespaceMap,
     cfgOptTablespaceMapAll,
     cfgOptTarget,
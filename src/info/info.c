@@ -164,14 +164,13 @@ typedef struct InfoLoadData
 } InfoLoadData;
 
 static void
-infoLoadCallback(void *data, const String *section, const String *key, const String *value, const Variant *valueVar)
+infoLoadCallback(void *data, const String *section, const String *key, const String *value)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM_P(VOID, data);
         FUNCTION_TEST_PARAM(STRING, section);
         FUNCTION_TEST_PARAM(STRING, key);
         FUNCTION_TEST_PARAM(STRING, value);
-        FUNCTION_TEST_PARAM(VARIANT, valueVar);
     FUNCTION_TEST_END();
 
     ASSERT(data != NULL);
@@ -206,20 +205,20 @@ infoLoadCallback(void *data, const String *section, const String *key, const Str
     // Process backrest section
     if (strEq(section, INFO_SECTION_BACKREST_STR))
     {
-        ASSERT(valueVar != NULL);
-
         // Validate format
         if (strEq(key, INFO_KEY_FORMAT_STR))
         {
-            if (varUInt64(valueVar) != REPOSITORY_FORMAT)
-                THROW_FMT(FormatError, "expected format %d but found %" PRIu64, REPOSITORY_FORMAT, varUInt64(valueVar));
+            const uint64_t format = jsonToUInt64(value);
+
+            if (format != REPOSITORY_FORMAT)
+                THROW_FMT(FormatError, "expected format %d but found %" PRIu64, REPOSITORY_FORMAT, format);
         }
         // Store pgBackRest version
         else if (strEq(key, INFO_KEY_VERSION_STR))
         {
             MEM_CONTEXT_BEGIN(loadData->info->memContext)
             {
-                loadData->info->backrestVersion = strDup(varStr(valueVar));
+                loadData->info->backrestVersion = jsonToStr(value);
             }
             MEM_CONTEXT_END();
         }
@@ -228,7 +227,7 @@ infoLoadCallback(void *data, const String *section, const String *key, const Str
         {
             MEM_CONTEXT_BEGIN(loadData->memContext)
             {
-                loadData->checksumExpected = strDup(varStr(valueVar));
+                loadData->checksumExpected = jsonToStr(value);
             }
             MEM_CONTEXT_END();
         }
@@ -236,21 +235,19 @@ infoLoadCallback(void *data, const String *section, const String *key, const Str
     // Process cipher section
     else if (strEq(section, INFO_SECTION_CIPHER_STR))
     {
-        ASSERT(valueVar != NULL);
-
         // No validation needed for cipher-pass, just store it
         if (strEq(key, INFO_KEY_CIPHER_PASS_STR))
         {
             MEM_CONTEXT_BEGIN(loadData->info->memContext)
             {
-                loadData->info->cipherPass = strDup(varStr(valueVar));
+                loadData->info->cipherPass = jsonToStr(value);
             }
             MEM_CONTEXT_END();
         }
     }
     // Else pass to callback for processing
     else
-        loadData->callbackFunction(loadData->callbackData, section, key, valueVar);
+        loadData->callbackFunction(loadData->callbackData, section, key, value);
 
     FUNCTION_TEST_RETURN_VOID();
 }
@@ -34,7 +34,9 @@ Function types for loading and saving
 // start at 0 and be incremented on each call.
 typedef bool InfoLoadCallback(void *data, unsigned int try);
 
-typedef void InfoLoadNewCallback(void *data, const String *section, const String *key, const Variant *value);
+// Called for each key/value in sections not handled by info. The value is JSON so the callback can convert or read only what it
+// needs.
+typedef void InfoLoadNewCallback(void *data, const String *section, const String *key, const String *value);
 typedef void InfoSaveCallback(void *data, const String *sectionNext, InfoSave *infoSaveData);
 
 /***********************************************************************************************************************************
@@ -118,13 +118,13 @@ infoBackupNew(unsigned int pgVersion, uint64_t pgSystemId, unsigned int pgCatalo
 Create new object and load contents from a file
 ***********************************************************************************************************************************/
 static void
-infoBackupLoadCallback(void *data, const String *section, const String *key, const Variant *value)
+infoBackupLoadCallback(void *data, const String *section, const String *key, const String *value)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM_P(VOID, data);
         FUNCTION_TEST_PARAM(STRING, section);
         FUNCTION_TEST_PARAM(STRING, key);
-        FUNCTION_TEST_PARAM(VARIANT, value);
+        FUNCTION_TEST_PARAM(STRING, value);
     FUNCTION_TEST_END();
 
     ASSERT(data != NULL);
@@ -137,7 +137,7 @@ infoBackupLoadCallback(void *data, const String *section, const String *key, con
     // Process current backup list
     if (strEq(section, INFO_BACKUP_SECTION_BACKUP_CURRENT_STR))
     {
-        const KeyValue *backupKv = varKv(value);
+        const KeyValue *backupKv = jsonToKv(value);
 
         MEM_CONTEXT_BEGIN(lstMemContext(infoBackup->backup))
         {
@@ -101,13 +101,13 @@ typedef struct InfoPgLoadData
 } InfoPgLoadData;
 
 static void
-infoPgLoadCallback(void *data, const String *section, const String *key, const Variant *value)
+infoPgLoadCallback(void *data, const String *section, const String *key, const String *value)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM_P(VOID, data);
         FUNCTION_TEST_PARAM(STRING, section);
         FUNCTION_TEST_PARAM(STRING, key);
-        FUNCTION_TEST_PARAM(VARIANT, value);
+        FUNCTION_TEST_PARAM(STRING, value);
     FUNCTION_TEST_END();
 
     ASSERT(data != NULL);
@@ -121,13 +121,13 @@ infoPgLoadCallback(void *data, const String *section, const String *key, const V
     if (strEq(section, INFO_SECTION_DB_STR))
     {
         if (strEq(key, INFO_KEY_DB_ID_STR))
-            loadData->currentId = varUIntForce(value);
+            loadData->currentId = jsonToUInt(value);
     }
     // Process db:history section
     else if (strEq(section, INFO_SECTION_DB_HISTORY_STR))
     {
         // Get db values that are common to all info files
-        const KeyValue *pgDataKv = varKv(value);
+        const KeyValue *pgDataKv = jsonToKv(value);
 
         InfoPgData infoPgData =
         {
@@ -71,10 +71,18 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
     STRING_STATIC(MANIFEST_KEY_BACKUP_TYPE_STR,                     MANIFEST_KEY_BACKUP_TYPE);
 #define MANIFEST_KEY_CHECKSUM                                       "checksum"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_VAR,                MANIFEST_KEY_CHECKSUM);
+#define MANIFEST_KEY_CHECKSUM_BLOCK                                 "checksum-block"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_BLOCK_VAR,          MANIFEST_KEY_CHECKSUM_BLOCK);
+#define MANIFEST_KEY_CHECKSUM_BLOCK_SHA1                            "checksum-block-sha1"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_BLOCK_SHA1_VAR,     MANIFEST_KEY_CHECKSUM_BLOCK_SHA1);
 #define MANIFEST_KEY_CHECKSUM_PAGE                                  "checksum-page"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_VAR,           MANIFEST_KEY_CHECKSUM_PAGE);
 #define MANIFEST_KEY_CHECKSUM_PAGE_ERROR                            "checksum-page-error"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR,     MANIFEST_KEY_CHECKSUM_PAGE_ERROR);
+#define MANIFEST_KEY_COMPRESS                                       "compress"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_COMPRESS_VAR,                MANIFEST_KEY_COMPRESS);
+#define MANIFEST_KEY_COMPRESS_LEVEL                                 "compress-level"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_COMPRESS_LEVEL_VAR,          MANIFEST_KEY_COMPRESS_LEVEL);
 #define MANIFEST_KEY_DB_CATALOG_VERSION                             "db-catalog-version"
     STRING_STATIC(MANIFEST_KEY_DB_CATALOG_VERSION_STR,              MANIFEST_KEY_DB_CATALOG_VERSION);
 #define MANIFEST_KEY_DB_ID                                          "db-id"
@@ -232,9 +240,13 @@ manifestFileAdd(Manifest *this, const ManifestFile *file)
     {
         ManifestFile fileAdd =
         {
+            .checksumBlockSize = file->checksumBlockSize,
+            .checksumBlockSha1 = strDup(file->checksumBlockSha1),
             .checksumPage = file->checksumPage,
             .checksumPageError = file->checksumPageError,
             .checksumPageErrorList = varLstDup(file->checksumPageErrorList),
+            .compressLevel = file->compressLevel,
+            .compressSkip = file->compressSkip,
             .group = manifestOwnerCache(this, file->group),
             .mode = file->mode,
             .name = strDup(file->name),
@@ -1117,6 +1129,138 @@ manifestBuildValidate(Manifest *this, bool delta, time_t copyStart, CompressType
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+// Update a file that has already been located in the file list
+static void
+manifestFileUpdateInternal(
+    Manifest *this, ManifestFile *file, uint64_t size, uint64_t sizeRepo, unsigned int compressLevel, bool compressSkip,
+    const char *checksumSha1, unsigned int checksumBlockSize, const String *checksumBlockSha1, const Variant *reference,
+    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, this);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+        FUNCTION_TEST_PARAM(UINT64, size);
+        FUNCTION_TEST_PARAM(UINT64, sizeRepo);
+        FUNCTION_TEST_PARAM(UINT, compressLevel);
+        FUNCTION_TEST_PARAM(BOOL, compressSkip);
+        FUNCTION_TEST_PARAM(STRINGZ, checksumSha1);
+        FUNCTION_TEST_PARAM(UINT, checksumBlockSize);
+        FUNCTION_TEST_PARAM(STRING, checksumBlockSha1);
+        FUNCTION_TEST_PARAM(VARIANT, reference);
+        FUNCTION_TEST_PARAM(BOOL, checksumPage);
+        FUNCTION_TEST_PARAM(BOOL, checksumPageError);
+        FUNCTION_TEST_PARAM(VARIANT_LIST, checksumPageErrorList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+    ASSERT(checksumBlockSize == 0 || (checksumBlockSha1 != NULL && strSize(checksumBlockSha1) == HASH_TYPE_SHA1_SIZE_HEX));
+
+    MEM_CONTEXT_BEGIN(lstMemContext(this->fileList))
+    {
+        // Update reference if set
+        if (reference != NULL)
+        {
+            if (varStr(reference) == NULL)
+                file->reference = NULL;
+            else
+                file->reference = strLstAddIfMissing(this->referenceList, varStr(reference));
+        }
+
+        // Update checksum if set
+        if (checksumSha1 != NULL)
+            memcpy(file->checksumSha1, checksumSha1, HASH_TYPE_SHA1_SIZE_HEX + 1);
+
+        // Update block checksum size and the checksum of the stored block checksums
+        file->checksumBlockSize = checksumBlockSize;
+        file->checksumBlockSha1 = checksumBlockSize != 0 ? strDup(checksumBlockSha1) : NULL;
+
+        // Update repo size and compression info
+        file->size = size;
+        file->sizeRepo = sizeRepo;
+        file->compressLevel = compressLevel;
+        file->compressSkip = compressSkip;
+
+        // Update checksum page info
+        file->checksumPage = checksumPage;
+        file->checksumPageError = checksumPageError;
+        file->checksumPageErrorList = varLstDup(checksumPageErrorList);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+#ifndef NDEBUG
+
+// Are the files sorted by name? Used to check that the file lists can be compared in a single pass.
+static bool
+manifestFileListSorted(const Manifest *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    bool result = true;
+
+    for (unsigned int fileIdx = 1; fileIdx < manifestFileTotal(this); fileIdx++)
+    {
+        if (strCmp(manifestFile(this, fileIdx - 1)->name, manifestFile(this, fileIdx)->name) >= 0)
+        {
+            result = false;
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+#endif
+
+// Find the prior file that matches the current file.  Both file lists are sorted by name so the prior list can be walked forward in
+// step with the current list rather than searching the entire prior list for every file, which matters when there are millions of
+// files.  The prior index is updated so the next search begins where this one left off.
+static const ManifestFile *
+manifestBuildIncrFilePrior(const Manifest *manifestPrior, const ManifestFile *file, unsigned int *filePriorIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, manifestPrior);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+        FUNCTION_TEST_PARAM_P(UINT, filePriorIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(manifestPrior != NULL);
+    ASSERT(file != NULL);
+    ASSERT(filePriorIdx != NULL);
+
+    const ManifestFile *result = NULL;
+
+    while (*filePriorIdx < manifestFileTotal(manifestPrior))
+    {
+        const ManifestFile *filePrior = manifestFile(manifestPrior, *filePriorIdx);
+        int compare = strCmp(filePrior->name, file->name);
+
+        // Prior file sorts after the current file so the current file is not in the prior manifest
+        if (compare > 0)
+            break;
+
+        (*filePriorIdx)++;
+
+        // Found a match
+        if (compare == 0)
+        {
+            result = filePrior;
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 void
 manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type, const String *archiveStart)
@@ -1133,6 +1277,8 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
     ASSERT(type == backupTypeDiff || type == backupTypeIncr);
     ASSERT(type != backupTypeDiff || manifestPrior->data.backupType == backupTypeFull);
     ASSERT(archiveStart == NULL || strSize(archiveStart) == 24);
+    ASSERT(manifestFileListSorted(this));
+    ASSERT(manifestFileListSorted(manifestPrior));
 
     MEM_CONTEXT_BEGIN(this->memContext)
     {
@@ -1171,10 +1317,12 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
         // loop below because delta changes the behavior of that loop.
         if (!varBool(this->data.backupOptionDelta))
         {
+            unsigned int filePriorIdx = 0;
+
             for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(this); fileIdx++)
             {
                 const ManifestFile *file = manifestFile(this, fileIdx);
-                const ManifestFile *filePrior = manifestFileFindDefault(manifestPrior, file->name, NULL);
+                const ManifestFile *filePrior = manifestBuildIncrFilePrior(manifestPrior, file, &filePriorIdx);
 
                 // If file was found in prior manifest then perform checks
                 if (filePrior != NULL)
@@ -1208,18 +1356,20 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
         // 1) that don't need to be copied because delta is disabled and the size and timestamp match or size matches and is zero
         // 2) where delta is enabled and size matches so checksum will be verified during backup and the file copied on mismatch
         bool delta = varBool(this->data.backupOptionDelta);
+        unsigned int filePriorIdx = 0;
 
         for (unsigned int fileIdx = 0; fileIdx < lstSize(this->fileList); fileIdx++)
         {
-            const ManifestFile *file = manifestFile(this, fileIdx);
-            const ManifestFile *filePrior = manifestFileFindDefault(manifestPrior, file->name, NULL);
+            ManifestFile *file = lstGet(this->fileList, fileIdx);
+            const ManifestFile *filePrior = manifestBuildIncrFilePrior(manifestPrior, file, &filePriorIdx);
 
             // Check if prior file can be used
             if (filePrior != NULL && file->size == filePrior->size &&
                 (delta || file->size == 0 || file->timestamp == filePrior->timestamp))
             {
-                manifestFileUpdate(
-                    this, file->name, file->size, filePrior->sizeRepo, filePrior->checksumSha1,
+                manifestFileUpdateInternal(
+                    this, file, file->size, filePrior->sizeRepo, filePrior->compressLevel, filePrior->compressSkip,
+                    filePrior->checksumSha1, filePrior->checksumBlockSize, filePrior->checksumBlockSha1,
                     VARSTR(filePrior->reference != NULL ? filePrior->reference : manifestPrior->data.backupLabel),
                     filePrior->checksumPage, filePrior->checksumPageError, filePrior->checksumPageErrorList);
             }
@@ -1322,6 +1472,7 @@ typedef struct ManifestLoadData
 {
     MemContext *memContext;                                         // Mem context for data needed only during load
     Manifest *manifest;                                             // Manifest info
+    bool summary;                                                   // Only store files with page checksum errors
 
     List *fileFoundList;                                            // Values found in files
     const Variant *fileGroupDefault;                                // File default group
@@ -1382,111 +1533,157 @@ manifestOwnerDefaultGet(const Variant *ownerDefault)
     FUNCTION_TEST_RETURN(varDup(ownerDefault));
 }
 
+// Helper to read an owner from JSON. See manifestOwnerGet() for details.
+static const String *
+manifestOwnerRead(JsonRead *json)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(JSON_READ, json);
+    FUNCTION_TEST_END();
+
+    ASSERT(json != NULL);
+
+    if (jsonReadTypeNext(json) == jsonTypeBool)
+    {
+        CHECK(!jsonReadBool(json));
+        FUNCTION_TEST_RETURN(NULL);
+    }
+
+    FUNCTION_TEST_RETURN(jsonReadStr(json));
+}
+
 static void
-manifestLoadCallback(void *callbackData, const String *section, const String *key, const Variant *value)
+manifestLoadCallback(void *callbackData, const String *section, const String *key, const String *valueJson)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM_P(VOID, callbackData);
         FUNCTION_TEST_PARAM(STRING, section);
         FUNCTION_TEST_PARAM(STRING, key);
-        FUNCTION_TEST_PARAM(VARIANT, value);
+        FUNCTION_TEST_PARAM(STRING, valueJson);
     FUNCTION_TEST_END();
 
     ASSERT(callbackData != NULL);
     ASSERT(section != NULL);
     ASSERT(key != NULL);
+    ASSERT(valueJson != NULL);
 
     ManifestLoadData *loadData = (ManifestLoadData *)callbackData;
     Manifest *manifest = loadData->manifest;
 
+    // The file section is by far the largest so it is read directly from the JSON to avoid building a KeyValue for every file.
+    // The other sections are small enough that converting to a variant is simpler.
+    const bool fileSection = strEq(section, MANIFEST_SECTION_TARGET_FILE_STR);
+    const Variant *const value = fileSection ? NULL : jsonToVar(valueJson);
+
     // -----------------------------------------------------------------------------------------------------------------------------
-    if (strEq(section, MANIFEST_SECTION_TARGET_FILE_STR))
+    if (fileSection)
     {
-        KeyValue *fileKv = varKv(value);
+        // Memory allocated here is freed by the ini loader since manifestFileAdd() makes copies of everything that is kept
+        ManifestLoadFound valueFound = {0};
+        ManifestFile file = {.name = key};
+        bool sizeFound = false;
+        bool sizeRepoFound = false;
+        bool timestampFound = false;
+        JsonRead *const json = jsonReadNew(valueJson);
 
-        MEM_CONTEXT_BEGIN(lstMemContext(manifest->fileList))
-        {
-            ManifestLoadFound valueFound = {0};
+        jsonReadObjectBegin(json);
 
-            ManifestFile file =
-            {
-                .name = key,
-                .reference = varStr(kvGetDefault(fileKv, MANIFEST_KEY_REFERENCE_VAR, NULL)),
-            };
-
-            // Timestamp is required so error if it is not present
-            const Variant *timestamp = kvGet(fileKv, MANIFEST_KEY_TIMESTAMP_VAR);
-
-            if (timestamp == NULL)
-                THROW_FMT(FormatError, "missing timestamp for file '%s'", strZ(key));
-
-            file.timestamp = (time_t)varUInt64(timestamp);
-
-            // Size is required so error if it is not present.  Older versions removed the size before the backup to ensure that the
-            // manifest was updated during the backup, so size can be missing in partial manifests.  This error will prevent older
-            // partials from being resumed.
-            const Variant *size = kvGet(fileKv, MANIFEST_KEY_SIZE_VAR);
-
-            if (size == NULL)
-                THROW_FMT(FormatError, "missing size for file '%s'", strZ(key));
-
-            file.size = varUInt64(size);
-
-            // If "repo-size" is not present in the manifest file, then it is the same as size (i.e. uncompressed) - to save space,
-            // the repo-size is only stored in the manifest file if it is different than size.
-            file.sizeRepo = varUInt64(kvGetDefault(fileKv, MANIFEST_KEY_SIZE_REPO_VAR, VARUINT64(file.size)));
-
-            // If file size is zero then assign the static zero hash
-            if (file.size == 0)
+        while (jsonReadTypeNext(json) != jsonTypeObjectEnd)
+        {
+            // The key might not exist if this is a partial save that was done during the backup to preserve checksums for
+            // already backed up files
+            if (jsonReadKeyMatchZ(json, MANIFEST_KEY_CHECKSUM))
             {
-                memcpy(file.checksumSha1, HASH_TYPE_SHA1_ZERO, HASH_TYPE_SHA1_SIZE_HEX + 1);
+                memcpy(file.checksumSha1, strZ(jsonReadStr(json)), HASH_TYPE_SHA1_SIZE_HEX + 1);
             }
-            // Else if the key exists then load it.  The key might not exist if this is a partial save that was done during the
-            // backup to preserve checksums for already backed up files.
-            else if (kvKeyExists(fileKv, MANIFEST_KEY_CHECKSUM_VAR))
-                memcpy(file.checksumSha1, strZ(varStr(kvGet(fileKv, MANIFEST_KEY_CHECKSUM_VAR))), HASH_TYPE_SHA1_SIZE_HEX + 1);
-
-            const Variant *checksumPage = kvGetDefault(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_VAR, NULL);
-
-            if (checksumPage != NULL)
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_CHECKSUM_BLOCK))
+                file.checksumBlockSize = jsonReadUInt(json);
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_CHECKSUM_BLOCK_SHA1))
+                file.checksumBlockSha1 = jsonReadStr(json);
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_CHECKSUM_PAGE))
             {
                 file.checksumPage = true;
-                file.checksumPageError = !varBool(checksumPage);
-
-                const Variant *checksumPageErrorList = kvGetDefault(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR, NULL);
-
-                if (checksumPageErrorList != NULL)
-                    file.checksumPageErrorList = varVarLst(checksumPageErrorList);
+                file.checksumPageError = !jsonReadBool(json);
             }
-
-            if (kvKeyExists(fileKv, MANIFEST_KEY_GROUP_VAR))
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_CHECKSUM_PAGE_ERROR))
+                file.checksumPageErrorList = varVarLst(jsonReadVar(json));
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_COMPRESS))
+                file.compressSkip = !jsonReadBool(json);
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_COMPRESS_LEVEL))
+                file.compressLevel = jsonReadUInt(json);
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_GROUP))
             {
                 valueFound.group = true;
-                file.group = manifestOwnerGet(kvGet(fileKv, MANIFEST_KEY_GROUP_VAR));
+                file.group = manifestOwnerRead(json);
             }
-
-            if (kvKeyExists(fileKv, MANIFEST_KEY_MODE_VAR))
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_PRIMARY))
+            {
+                valueFound.primary = true;
+                file.primary = jsonReadBool(json);
+            }
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_MODE))
             {
                 valueFound.mode = true;
-                file.mode = cvtZToMode(strZ(varStr(kvGet(fileKv, MANIFEST_KEY_MODE_VAR))));
+                file.mode = cvtZToMode(strZ(jsonReadStr(json)));
             }
-
-            if (kvKeyExists(fileKv, MANIFEST_KEY_PRIMARY_VAR))
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_REFERENCE))
+                file.reference = jsonReadStr(json);
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_SIZE_REPO))
             {
-                valueFound.primary = true;
-                file.primary = varBool(kvGet(fileKv, MANIFEST_KEY_PRIMARY_VAR));
+                sizeRepoFound = true;
+                file.sizeRepo = jsonReadUInt64(json);
             }
-
-            if (kvKeyExists(fileKv, MANIFEST_KEY_USER_VAR))
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_SIZE))
+            {
+                sizeFound = true;
+                file.size = jsonReadUInt64(json);
+            }
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_TIMESTAMP))
+            {
+                timestampFound = true;
+                file.timestamp = (time_t)jsonReadUInt64(json);
+            }
+            else if (jsonReadKeyMatchZ(json, MANIFEST_KEY_USER))
             {
                 valueFound.user = true;
-                file.user = manifestOwnerGet(kvGet(fileKv, MANIFEST_KEY_USER_VAR));
+                file.user = manifestOwnerRead(json);
             }
+            else
+                jsonReadSkip(json);
+        }
+
+        jsonReadObjectEnd(json);
+        jsonReadFree(json);
+
+        // Timestamp is required so error if it is not present
+        if (!timestampFound)
+            THROW_FMT(FormatError, "missing timestamp for file '%s'", strZ(key));
 
+        // Size is required so error if it is not present.  Older versions removed the size before the backup to ensure that the
+        // manifest was updated during the backup, so size can be missing in partial manifests.  This error will prevent older
+        // partials from being resumed.
+        if (!sizeFound)
+            THROW_FMT(FormatError, "missing size for file '%s'", strZ(key));
+
+        // If "repo-size" is not present in the manifest file, then it is the same as size (i.e. uncompressed) - to save space,
+        // the repo-size is only stored in the manifest file if it is different than size.
+        if (!sizeRepoFound)
+            file.sizeRepo = file.size;
+
+        // If file size is zero then assign the static zero hash
+        if (file.size == 0)
+            memcpy(file.checksumSha1, HASH_TYPE_SHA1_ZERO, HASH_TYPE_SHA1_SIZE_HEX + 1);
+
+        // Checksum page errors are only valid when page checksums were checked
+        if (!file.checksumPage)
+            file.checksumPageErrorList = NULL;
+
+        // A summary load only needs files with page checksum errors so skip storing the rest
+        if (!loadData->summary || file.checksumPageError)
+        {
             lstAdd(loadData->fileFoundList, &valueFound);
             manifestFileAdd(manifest, &file);
         }
-        MEM_CONTEXT_END();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -1731,11 +1928,12 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
     FUNCTION_TEST_RETURN_VOID();
 }
 
-Manifest *
-manifestNewLoad(IoRead *read)
+static Manifest *
+manifestNewLoadInternal(IoRead *read, bool summary)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(BOOL, summary);
     FUNCTION_LOG_END();
 
     ASSERT(read != NULL);
@@ -1751,6 +1949,7 @@ manifestNewLoad(IoRead *read)
         {
             .memContext = memContextNew("load"),
             .manifest = this,
+            .summary = summary,
         };
 
         MEM_CONTEXT_BEGIN(loadData.memContext)
@@ -1834,6 +2033,26 @@ manifestNewLoad(IoRead *read)
     FUNCTION_LOG_RETURN(MANIFEST, this);
 }
 
+Manifest *
+manifestNewLoad(IoRead *read)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST, manifestNewLoadInternal(read, false));
+}
+
+Manifest *
+manifestNewLoadSummary(IoRead *read)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST, manifestNewLoadInternal(read, true));
+}
+
 /**********************************************************************************************************************************/
 typedef struct ManifestSaveData
 {
@@ -2102,6 +2321,12 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 if (file->size != 0 && file->checksumSha1[0] != 0)
                     kvPut(fileKv, MANIFEST_KEY_CHECKSUM_VAR, VARSTRZ(file->checksumSha1));
 
+                if (file->checksumBlockSize != 0)
+                {
+                    kvPut(fileKv, MANIFEST_KEY_CHECKSUM_BLOCK_VAR, VARUINT(file->checksumBlockSize));
+                    kvPut(fileKv, MANIFEST_KEY_CHECKSUM_BLOCK_SHA1_VAR, VARSTR(file->checksumBlockSha1));
+                }
+
                 if (file->checksumPage)
                 {
                     kvPut(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_VAR, VARBOOL(!file->checksumPageError));
@@ -2110,6 +2335,12 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                         kvPut(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR, varNewVarLst(file->checksumPageErrorList));
                 }
 
+                if (file->compressSkip)
+                    kvPut(fileKv, MANIFEST_KEY_COMPRESS_VAR, BOOL_FALSE_VAR);
+
+                if (file->compressLevel != 0)
+                    kvPut(fileKv, MANIFEST_KEY_COMPRESS_LEVEL_VAR, varNewUInt(file->compressLevel));
+
                 if (!varEq(manifestOwnerVar(file->group), saveData->fileGroupDefault))
                     kvPut(fileKv, MANIFEST_KEY_GROUP_VAR, manifestOwnerVar(file->group));
 
@@ -2554,6 +2785,61 @@ manifestFileFindDefault(const Manifest *this, const String *name, const Manifest
     FUNCTION_TEST_RETURN(lstFindDefault(this->fileList, &name, (void *)fileDefault));
 }
 
+// Find the first file that sorts at or after the path followed by the separator character. Only the path and separator are compared
+// so no string needs to be built for the search.
+static unsigned int
+manifestFileIdxLowerBound(const Manifest *this, const String *path, char separator)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, this);
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM(CHAR, separator);
+    FUNCTION_TEST_END();
+
+    unsigned int fileIdxLow = 0;
+    unsigned int fileIdxHigh = lstSize(this->fileList);
+
+    while (fileIdxLow < fileIdxHigh)
+    {
+        const unsigned int fileIdxMid = fileIdxLow + (fileIdxHigh - fileIdxLow) / 2;
+        const char *const name = strZ(((const ManifestFile *)lstGet(this->fileList, fileIdxMid))->name);
+        int compare = strncmp(name, strZ(path), strSize(path));
+
+        if (compare == 0)
+            compare = (unsigned char)name[strSize(path)] - (unsigned char)separator;
+
+        if (compare < 0)
+            fileIdxLow = fileIdxMid + 1;
+        else
+            fileIdxHigh = fileIdxMid;
+    }
+
+    FUNCTION_TEST_RETURN(fileIdxLow);
+}
+
+void
+manifestFileRange(const Manifest *this, const String *path, unsigned int *fileIdxBegin, unsigned int *fileIdxEnd)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, this);
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM_P(UINT, fileIdxBegin);
+        FUNCTION_TEST_PARAM_P(UINT, fileIdxEnd);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+    ASSERT(fileIdxBegin != NULL);
+    ASSERT(fileIdxEnd != NULL);
+
+    // Files in the path all begin with path/ so they are contiguous in the sorted list. The range ends at the first file that sorts
+    // at or after path0 since 0 is the character directly after / in the ASCII table.
+    *fileIdxBegin = manifestFileIdxLowerBound(this, path, '/');
+    *fileIdxEnd = manifestFileIdxLowerBound(this, path, '0');
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 void
 manifestFileRemove(const Manifest *this, const String *name)
 {
@@ -2585,7 +2871,8 @@ manifestFileTotal(const Manifest *this)
 
 void
 manifestFileUpdate(
-    Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
+    Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, unsigned int compressLevel, bool compressSkip,
+    const char *checksumSha1, unsigned int checksumBlockSize, const String *checksumBlockSha1, const Variant *reference,
     bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList)
 {
     FUNCTION_TEST_BEGIN();
@@ -2593,7 +2880,11 @@ manifestFileUpdate(
         FUNCTION_TEST_PARAM(STRING, name);
         FUNCTION_TEST_PARAM(UINT64, size);
         FUNCTION_TEST_PARAM(UINT64, sizeRepo);
+        FUNCTION_TEST_PARAM(UINT, compressLevel);
+        FUNCTION_TEST_PARAM(BOOL, compressSkip);
         FUNCTION_TEST_PARAM(STRINGZ, checksumSha1);
+        FUNCTION_TEST_PARAM(UINT, checksumBlockSize);
+        FUNCTION_TEST_PARAM(STRING, checksumBlockSha1);
         FUNCTION_TEST_PARAM(VARIANT, reference);
         FUNCTION_TEST_PARAM(BOOL, checksumPage);
         FUNCTION_TEST_PARAM(BOOL, checksumPageError);
@@ -2606,33 +2897,9 @@ manifestFileUpdate(
         (!checksumPage && !checksumPageError && checksumPageErrorList == NULL) ||
         (checksumPage && !checksumPageError && checksumPageErrorList == NULL) || (checksumPage && checksumPageError));
 
-    ManifestFile *file = (ManifestFile *)manifestFileFind(this, name);
-
-    MEM_CONTEXT_BEGIN(lstMemContext(this->fileList))
-    {
-        // Update reference if set
-        if (reference != NULL)
-        {
-            if (varStr(reference) == NULL)
-                file->reference = NULL;
-            else
-                file->reference = strLstAddIfMissing(this->referenceList, varStr(reference));
-        }
-
-        // Update checksum if set
-        if (checksumSha1 != NULL)
-            memcpy(file->checksumSha1, checksumSha1, HASH_TYPE_SHA1_SIZE_HEX + 1);
-
-        // Update repo size
-        file->size = size;
-        file->sizeRepo = sizeRepo;
-
-        // Update checksum page info
-        file->checksumPage = checksumPage;
-        file->checksumPageError = checksumPageError;
-        file->checksumPageErrorList = varLstDup(checksumPageErrorList);
-    }
-    MEM_CONTEXT_END();
+    manifestFileUpdateInternal(
+        this, (ManifestFile *)manifestFileFind(this, name), size, sizeRepo, compressLevel, compressSkip, checksumSha1,
+        checksumBlockSize, checksumBlockSha1, reference, checksumPage, checksumPageError, checksumPageErrorList);
 
     FUNCTION_TEST_RETURN_VOID();
 }
@@ -3046,6 +3313,7 @@ typedef struct ManifestLoadFileData
     const String *fileName;                                         // Base filename
     CipherType cipherType;                                          // Cipher type
     const String *cipherPass;                                       // Cipher passphrase
+    bool summary;                                                   // Load summary only?
     Manifest *manifest;                                             // Loaded manifest object
 } ManifestLoadFileData;
 
@@ -3073,7 +3341,7 @@ manifestLoadFileCallback(void *data, unsigned int try)
 
         MEM_CONTEXT_BEGIN(loadData->memContext)
         {
-            loadData->manifest = manifestNewLoad(read);
+            loadData->manifest = manifestNewLoadInternal(read, loadData->summary);
             result = true;
         }
         MEM_CONTEXT_END();
@@ -3082,14 +3350,16 @@ manifestLoadFileCallback(void *data, unsigned int try)
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
-Manifest *
-manifestLoadFile(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass)
+static Manifest *
+manifestLoadFileInternal(
+    const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass, bool summary)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE, storage);
         FUNCTION_LOG_PARAM(STRING, fileName);
         FUNCTION_LOG_PARAM(ENUM, cipherType);
         FUNCTION_TEST_PARAM(STRING, cipherPass);
+        FUNCTION_LOG_PARAM(BOOL, summary);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
@@ -3103,6 +3373,7 @@ manifestLoadFile(const Storage *storage, const String *fileName, CipherType ciph
         .fileName = fileName,
         .cipherType = cipherType,
         .cipherPass = cipherPass,
+        .summary = summary,
     };
 
     MEM_CONTEXT_TEMP_BEGIN()
@@ -3117,3 +3388,29 @@ manifestLoadFile(const Storage *storage, const String *fileName, CipherType ciph
 
     FUNCTION_LOG_RETURN(MANIFEST, data.manifest);
 }
+
+Manifest *
+manifestLoadFile(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST, manifestLoadFileInternal(storage, fileName, cipherType, cipherPass, false));
+}
+
+Manifest *
+manifestLoadFileSummary(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST, manifestLoadFileInternal(storage, fileName, cipherType, cipherPass, true));
+}
@@ -26,6 +26,9 @@ Constants
 #define MANIFEST_TARGET_PGTBLSPC                                    "pg_tblspc"
     STRING_DECLARE(MANIFEST_TARGET_PGTBLSPC_STR);
 
+// Path in the backup where block checksums are stored for files that have them, e.g. block/pg_data/base/1/1
+#define MANIFEST_PATH_BLOCK                                         "block"
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -96,9 +99,13 @@ typedef struct ManifestFile
     bool primary:1;                                                 // Should this file be copied from the primary?
     bool checksumPage:1;                                            // Does this file have page checksums?
     bool checksumPageError:1;                                       // Is there an error in the page checksum?
+    bool compressSkip:1;                                            // Stored without compression because it is incompressible?
     mode_t mode;                                                    // File mode
     char checksumSha1[HASH_TYPE_SHA1_SIZE_HEX + 1];                 // SHA1 checksum
+    unsigned int checksumBlockSize;                                 // Block size when block checksums are stored (0 if not stored)
+    unsigned int compressLevel;                                     // Compress level when adaptive (0 if option-compress-level)
     const VariantList *checksumPageErrorList;                       // List of page checksum errors if there are any
+    const String *checksumBlockSha1;                                // SHA1 checksum of stored block checksums (NULL if not stored)
     const String *user;                                             // User name
     const String *group;                                            // Group name
     const String *reference;                                        // Reference to a prior backup
@@ -159,13 +166,18 @@ Manifest *manifestNewBuild(
 // Load a manifest from IO
 Manifest *manifestNewLoad(IoRead *read);
 
+// Load a manifest from IO but only store files with page checksum errors. This is faster and uses far less memory when only the
+// backup data, databases, targets, paths, and links are needed.
+Manifest *manifestNewLoadSummary(IoRead *read);
+
 /***********************************************************************************************************************************
 Build functions
 ***********************************************************************************************************************************/
 // Validate the timestamps in the manifest given a copy start time, i.e. all times should be <= the copy start time
 void manifestBuildValidate(Manifest *this, bool delta, time_t copyStart, CompressType compressType);
 
-// Create a diff/incr backup by comparing to a previous backup manifest
+// Create a diff/incr backup by comparing to a previous backup manifest. The file lists of both manifests must be sorted, which is
+// always the case after a build or load.
 void manifestBuildIncr(Manifest *this, const Manifest *prior, BackupType type, const String *archiveStart);
 
 // Set remaining values before the final save
@@ -205,12 +217,18 @@ const ManifestFile *manifestFile(const Manifest *this, unsigned int fileIdx);
 void manifestFileAdd(Manifest *this, const ManifestFile *file);
 const ManifestFile *manifestFileFind(const Manifest *this, const String *name);
 const ManifestFile *manifestFileFindDefault(const Manifest *this, const String *name, const ManifestFile *fileDefault);
+
+// Get the range of files in a path (including subpaths) as fileIdxBegin to fileIdxEnd (exclusive). This is a binary search so the
+// file list must be sorted, which is always the case after a build or load.
+void manifestFileRange(const Manifest *this, const String *path, unsigned int *fileIdxBegin, unsigned int *fileIdxEnd);
+
 void manifestFileRemove(const Manifest *this, const String *name);
 unsigned int manifestFileTotal(const Manifest *this);
 
 // Update a file with new data
 void manifestFileUpdate(
-    Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
+    Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, unsigned int compressLevel, bool compressSkip,
+    const char *checksumSha1, unsigned int checksumBlockSize, const String *checksumBlockSha1, const Variant *reference,
     bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList);
 
 /***********************************************************************************************************************************
@@ -276,6 +294,9 @@ Helper functions
 // Load backup manifest
 Manifest *manifestLoadFile(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass);
 
+// Load backup manifest summary (see manifestNewLoadSummary())
+Manifest *manifestLoadFileSummary(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
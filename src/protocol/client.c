@@ -6,6 +6,7 @@ Protocol Client
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/time.h"
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
@@ -28,6 +29,8 @@ STRING_EXTERN(PROTOCOL_ERROR_STACK_STR,                             PROTOCOL_ERR
 
 STRING_EXTERN(PROTOCOL_OUTPUT_STR,                                  PROTOCOL_OUTPUT);
 
+STRING_EXTERN(PROTOCOL_STAT_REQUEST_STR,                            PROTOCOL_STAT_REQUEST);
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -139,27 +142,58 @@ protocolClientNew(const String *name, const String *service, IoRead *read, IoWri
 }
 
 /**********************************************************************************************************************************/
-// Helper to process errors
-static void
-protocolClientProcessError(ProtocolClient *this, KeyValue *errorKv)
+// Helper to process a response and throw the error if there is one. The response is read with a pull-style reader so only the
+// output is converted to a variant, which is created in the calling context.
+static const Variant *
+protocolClientProcessResponse(ProtocolClient *this, const String *response)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, this);
-        FUNCTION_LOG_PARAM(KEY_VALUE, errorKv);
+        FUNCTION_LOG_PARAM(STRING, response);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(errorKv != NULL);
+    ASSERT(response != NULL);
+
+    const Variant *result = NULL;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Process error if any
-        const Variant *error = kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STR));
+        JsonRead *const json = jsonReadNew(response);
+        bool error = false;
+        int errorCode = 0;
+        const String *errorStack = NULL;
+
+        jsonReadObjectBegin(json);
+
+        while (jsonReadTypeNext(json) != jsonTypeObjectEnd)
+        {
+            if (jsonReadKeyMatchZ(json, PROTOCOL_ERROR))
+            {
+                error = true;
+                errorCode = jsonReadInt(json);
+            }
+            else if (jsonReadKeyMatchZ(json, PROTOCOL_ERROR_STACK))
+                errorStack = jsonReadStr(json);
+            else if (jsonReadKeyMatchZ(json, PROTOCOL_OUTPUT))
+            {
+                MEM_CONTEXT_PRIOR_BEGIN()
+                {
+                    result = jsonReadVar(json);
+                }
+                MEM_CONTEXT_PRIOR_END();
+            }
+            else
+                jsonReadSkip(json);
+        }
 
-        if (error != NULL)
+        jsonReadObjectEnd(json);
+
+        // Process error if any
+        if (error)
         {
-            const ErrorType *type = errorTypeFromCode(varIntForce(error));
-            const String *message = varStr(kvGet(errorKv, VARSTR(PROTOCOL_OUTPUT_STR)));
+            const ErrorType *type = errorTypeFromCode(errorCode);
+            const String *message = result == NULL ? NULL : varStr(result);
 
             // Required part of the message
             String *throwMessage = strNewFmt(
@@ -168,10 +202,8 @@ protocolClientProcessError(ProtocolClient *this, KeyValue *errorKv)
             // Add stack trace if the error is an assertion or debug-level logging is enabled
             if (type == &AssertError || logAny(logLevelDebug))
             {
-                const String *stack = varStr(kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STACK_STR)));
-
                 strCat(throwMessage, LF_STR);
-                strCat(throwMessage, stack == NULL ? STRDEF("no stack trace available") : stack);
+                strCat(throwMessage, errorStack == NULL ? STRDEF("no stack trace available") : errorStack);
             }
 
             THROWP(type, strZ(throwMessage));
@@ -179,7 +211,7 @@ protocolClientProcessError(ProtocolClient *this, KeyValue *errorKv)
     }
     MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN_VOID();
+    FUNCTION_LOG_RETURN_CONST(VARIANT, result);
 }
 
 const Variant *
@@ -197,22 +229,19 @@ protocolClientReadOutput(ProtocolClient *this, bool outputRequired)
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // Read the response
-        String *response = ioReadLine(this->read);
-        KeyValue *responseKv = varKv(jsonToVar(response));
-
-        // Process error if any
-        protocolClientProcessError(this, responseKv);
-
-        // Get output
-        result = kvGet(responseKv, VARSTR(PROTOCOL_OUTPUT_STR));
+        const String *response = ioReadLine(this->read);
 
+        // Process error if any and get output
         if (outputRequired)
         {
-            // Just move the entire response kv since the output is the largest part if it
-            kvMove(responseKv, memContextPrior());
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = protocolClientProcessResponse(this, response);
+            }
+            MEM_CONTEXT_PRIOR_END();
         }
         // Else if no output is required then there should not be any
-        else if (result != NULL)
+        else if (protocolClientProcessResponse(this, response) != NULL)
             THROW(AssertError, "no output required by command");
 
         // Reset the keep alive time
@@ -258,9 +287,16 @@ protocolClientExecute(ProtocolClient *this, const ProtocolCommand *command, bool
     ASSERT(this != NULL);
     ASSERT(command != NULL);
 
+    TimeUSec timeBegin = timeUSec();
+
     protocolClientWriteCommand(this, command);
+    const Variant *result = protocolClientReadOutput(this, outputRequired);
 
-    FUNCTION_LOG_RETURN_CONST(VARIANT, protocolClientReadOutput(this, outputRequired));
+    // Record round trip latency for the request
+    statInc(PROTOCOL_STAT_REQUEST_STR);
+    statTimeEnd(PROTOCOL_STAT_REQUEST_STR, timeBegin);
+
+    FUNCTION_LOG_RETURN_CONST(VARIANT, result);
 }
 
 /**********************************************************************************************************************************/
@@ -304,10 +340,8 @@ protocolClientReadLine(ProtocolClient *this)
         }
         else if (strZ(result)[0] == '{')
         {
-            KeyValue *responseKv = varKv(jsonToVar(result));
-
             // Process expected error
-            protocolClientProcessError(this, responseKv);
+            protocolClientProcessResponse(this, result);
 
             // If not an error then there is probably a protocol bug
             THROW(FormatError, "expected error but got output");
@@ -39,6 +39,12 @@ Constants
 #define PROTOCOL_OUTPUT                                             "out"
     STRING_DECLARE(PROTOCOL_OUTPUT_STR);
 
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+#define PROTOCOL_STAT_REQUEST                                       "protocol.request"  // Requests executed and latency
+    STRING_DECLARE(PROTOCOL_STAT_REQUEST_STR);
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
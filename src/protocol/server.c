@@ -142,9 +142,23 @@ protocolServerProcess(ProtocolServer *this, const VariantList *retryInterval)
             MEM_CONTEXT_TEMP_BEGIN()
             {
                 // Read command
-                KeyValue *commandKv = jsonToKv(ioReadLine(this->read));
-                const String *command = varStr(kvGet(commandKv, VARSTR(PROTOCOL_KEY_COMMAND_STR)));
-                VariantList *paramList = varVarLst(kvGet(commandKv, VARSTR(PROTOCOL_KEY_PARAMETER_STR)));
+                JsonRead *const json = jsonReadNew(ioReadLine(this->read));
+                const String *command = NULL;
+                VariantList *paramList = NULL;
+
+                jsonReadObjectBegin(json);
+
+                while (jsonReadTypeNext(json) != jsonTypeObjectEnd)
+                {
+                    if (jsonReadKeyMatchZ(json, PROTOCOL_KEY_COMMAND))
+                        command = jsonReadStr(json);
+                    else if (jsonReadKeyMatchZ(json, PROTOCOL_KEY_PARAMETER))
+                        paramList = varVarLst(jsonReadVar(json));
+                    else
+                        jsonReadSkip(json);
+                }
+
+                jsonReadObjectEnd(json);
 
                 // Process command
                 bool found = false;
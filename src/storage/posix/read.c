@@ -86,6 +86,13 @@ storageReadPosixOpen(THIS_VOID)
     if (this->fd != -1)
     {
         memContextCallbackSet(this->memContext, storageReadPosixFreeResource, this);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+        // Tell the kernel the file will be read sequentially so it reads ahead more aggressively. Failure is ignored since this
+        // is only a hint.
+        posix_fadvise(this->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
         result = true;
     }
 
@@ -135,6 +142,12 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
         // not concerned with files that are growing.  Just read up to the point where the file is being extended.
         if ((size_t)actualBytes != expectedBytes || this->current == this->limit)
             this->eof = true;
+#ifdef POSIX_FADV_WILLNEED
+        // Else request the next block now so the disk read runs in the background while the caller processes this block through
+        // the filters (e.g. compression and encryption). Failure is ignored since this is only a hint.
+        else
+            posix_fadvise(this->fd, (off_t)this->current, (off_t)expectedBytes, POSIX_FADV_WILLNEED);
+#endif
     }
 
     FUNCTION_LOG_RETURN(SIZE, (size_t)actualBytes);
@@ -42,31 +42,50 @@ struct StoragePosix
     MemContext *memContext;                                         // Object memory context
 };
 
-/**********************************************************************************************************************************/
-static StorageInfo
-storagePosixInfo(THIS_VOID, const String *file, StorageInfoLevel level, StorageInterfaceInfoParam param)
+/***********************************************************************************************************************************
+Get the full name of a file for error messages. Only called on error so the name is not built for every file in a list.
+***********************************************************************************************************************************/
+static const char *
+storagePosixInfoAtFile(const String *path, const String *name)
 {
-    THIS(StoragePosix);
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
 
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
-        FUNCTION_LOG_PARAM(STRING, file);
-        FUNCTION_LOG_PARAM(ENUM, level);
-        FUNCTION_LOG_PARAM(BOOL, param.followLink);
-    FUNCTION_LOG_END();
+    ASSERT(path != NULL);
 
-    ASSERT(this != NULL);
-    ASSERT(file != NULL);
+    FUNCTION_TEST_RETURN(name == NULL ? strZ(path) : strZ(strNewFmt("%s/%s", strZ(path), strZ(name))));
+}
+
+/***********************************************************************************************************************************
+Get info for a file. When a directory fd is provided the name is relative to the directory, which avoids building a full path and
+having the kernel resolve it again for every entry in a list. When name is NULL path is used as the file and dirFd must be AT_FDCWD.
+***********************************************************************************************************************************/
+static StorageInfo
+storagePosixInfoAt(int dirFd, const String *path, const String *name, StorageInfoLevel level, bool followLink)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, dirFd);
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(ENUM, level);
+        FUNCTION_TEST_PARAM(BOOL, followLink);
+    FUNCTION_TEST_END();
+
+    ASSERT(path != NULL);
+    ASSERT(name != NULL || dirFd == AT_FDCWD);
 
     StorageInfo result = {.level = level};
+    const char *file = strZ(name == NULL ? path : name);
 
     // Stat the file to check if it exists
     struct stat statFile;
 
-    if ((param.followLink ? stat(strZ(file), &statFile) : lstat(strZ(file), &statFile)) == -1)
+    if (fstatat(dirFd, file, &statFile, followLink ? 0 : AT_SYMLINK_NOFOLLOW) == -1)
     {
         if (errno != ENOENT)                                                                                        // {vm_covered}
-            THROW_SYS_ERROR_FMT(FileOpenError, STORAGE_ERROR_INFO, strZ(file));                                     // {vm_covered}
+            THROW_SYS_ERROR_FMT(FileOpenError, STORAGE_ERROR_INFO, storagePosixInfoAtFile(path, name));             // {vm_covered}
     }
     // On success the file exists
     else
@@ -95,9 +114,9 @@ storagePosixInfo(THIS_VOID, const String *file, StorageInfoLevel level, StorageI
         if (result.level >= storageInfoLevelDetail)
         {
             result.groupId = statFile.st_gid;
-            result.group = groupNameFromId(result.groupId);
+            result.group = groupNameFromIdCache(result.groupId);
             result.userId = statFile.st_uid;
-            result.user = userNameFromId(result.userId);
+            result.user = userNameFromIdCache(result.userId);
             result.mode = statFile.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO);
 
             if (result.type == storageTypeLink)
@@ -106,15 +125,79 @@ storagePosixInfo(THIS_VOID, const String *file, StorageInfoLevel level, StorageI
                 ssize_t linkDestinationSize = 0;
 
                 THROW_ON_SYS_ERROR_FMT(
-                    (linkDestinationSize = readlink(strZ(file), linkDestination, sizeof(linkDestination) - 1)) == -1,
-                    FileReadError, "unable to get destination for link '%s'", strZ(file));
+                    (linkDestinationSize = readlinkat(dirFd, file, linkDestination, sizeof(linkDestination) - 1)) == -1,
+                    FileReadError, "unable to get destination for link '%s'", storagePosixInfoAtFile(path, name));
 
                 result.linkDestination = strNewN(linkDestination, (size_t)linkDestinationSize);
             }
         }
     }
 
-    FUNCTION_LOG_RETURN(STORAGE_INFO, result);
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+static void
+storagePosixFileSync(THIS_VOID, const String *file, StorageInterfaceFileSyncParam param)
+{
+    THIS(StoragePosix);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+        (void)param;                                                // No parameters are used
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    // Open the file read-only since only data that has already been written needs to be synced
+    int fd = open(strZ(file), O_RDONLY, 0);
+
+    // Handle errors
+    if (fd == -1)
+    {
+        if (errno == ENOENT)
+            THROW_FMT(FileMissingError, STORAGE_ERROR_FILE_SYNC_MISSING, strZ(file));
+        else
+            THROW_SYS_ERROR_FMT(FileOpenError, STORAGE_ERROR_FILE_SYNC_OPEN, strZ(file));                           // {vm_covered}
+    }
+    else
+    {
+        // Attempt to sync the file
+        if (fsync(fd) == -1)
+        {
+            int errNo = errno;
+
+            // Close the file descriptor to free resources but don't check for failure
+            close(fd);
+
+            THROW_SYS_ERROR_CODE_FMT(errNo, FileSyncError, STORAGE_ERROR_FILE_SYNC, strZ(file));
+        }
+
+        THROW_ON_SYS_ERROR_FMT(close(fd) == -1, FileCloseError, STORAGE_ERROR_FILE_SYNC_CLOSE, strZ(file));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+static StorageInfo
+storagePosixInfo(THIS_VOID, const String *file, StorageInfoLevel level, StorageInterfaceInfoParam param)
+{
+    THIS(StoragePosix);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(ENUM, level);
+        FUNCTION_LOG_PARAM(BOOL, param.followLink);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_LOG_RETURN(STORAGE_INFO, storagePosixInfoAt(AT_FDCWD, file, NULL, level, param.followLink));
 }
 
 /**********************************************************************************************************************************/
@@ -123,11 +206,11 @@ storagePosixInfo(THIS_VOID, const String *file, StorageInfoLevel level, StorageI
 // get complete test coverage this function must be split out.
 static void
 storagePosixInfoListEntry(
-    StoragePosix *this, const String *path, const String *name, StorageInfoLevel level, StorageInfoListCallback callback,
+    int dirFd, const String *path, const String *name, StorageInfoLevel level, StorageInfoListCallback callback,
     void *callbackData)
 {
     FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM(STORAGE_POSIX, this);
+        FUNCTION_TEST_PARAM(INT, dirFd);
         FUNCTION_TEST_PARAM(STRING, path);
         FUNCTION_TEST_PARAM(STRING, name);
         FUNCTION_TEST_PARAM(ENUM, level);
@@ -135,13 +218,14 @@ storagePosixInfoListEntry(
         FUNCTION_TEST_PARAM_P(VOID, callbackData);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL);
     ASSERT(path != NULL);
     ASSERT(name != NULL);
     ASSERT(callback != NULL);
 
-    StorageInfo storageInfo = storageInterfaceInfoP(
-        this, strEq(name, DOT_STR) ? strDup(path) : strNewFmt("%s/%s", strZ(path), strZ(name)), level);
+    // Stat relative to the directory being listed. The path itself is stat'd directly since it may be a link that was followed when
+    // the directory was opened.
+    StorageInfo storageInfo = strEq(name, DOT_STR) ?
+        storagePosixInfoAt(AT_FDCWD, path, NULL, level, false) : storagePosixInfoAt(dirFd, path, name, level, false);
 
     if (storageInfo.exists)
     {
@@ -190,6 +274,9 @@ storagePosixInfoList(
 
         TRY_BEGIN()
         {
+            // Entries are stat'd relative to the open directory so the path does not need to be resolved for each entry
+            const int dirFd = dirfd(dir);
+
             MEM_CONTEXT_TEMP_RESET_BEGIN()
             {
                 // Read the directory entries
@@ -210,7 +297,7 @@ storagePosixInfoList(
                         }
                         // Else more info is required which requires a call to stat()
                         else
-                            storagePosixInfoListEntry(this, path, name, level, callback, callbackData);
+                            storagePosixInfoListEntry(dirFd, path, name, level, callback, callbackData);
                     }
 
                     // Get next entry
@@ -351,7 +438,8 @@ storagePosixNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWritePara
         STORAGE_WRITE,
         storageWritePosixNew(
             this, file, param.modeFile, param.modePath, param.user, param.group, param.timeModified, param.createPath,
-            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic));
+            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic, param.sparse,
+            param.writeBehind, param.noTruncate, param.offset));
 }
 
 /**********************************************************************************************************************************/
@@ -552,6 +640,7 @@ static const StorageInterface storageInterfacePosix =
 {
     .feature = 1 << storageFeaturePath | 1 << storageFeatureCompress | 1 << storageFeatureLimitRead,
 
+    .fileSync = storagePosixFileSync,
     .info = storagePosixInfo,
     .infoList = storagePosixInfoList,
     .move = storagePosixMove,
@@ -3,8 +3,14 @@ Posix Storage File write
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+// Required for sync_file_range() on Linux
+#ifdef __linux__
+    #define _GNU_SOURCE
+#endif
+
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
@@ -33,6 +39,10 @@ typedef struct StorageWritePosix
     const String *nameTmp;
     const String *path;
     int fd;                                                         // File descriptor
+    uint64_t size;                                                  // Offset in the file where the next write starts
+    bool sparse;                                                    // Seek over zero blocks rather than writing them
+    bool writeBehind;                                               // Start writeback and drop written data from the page cache
+    bool noTruncate;                                                // Write into the existing file at size without truncating it
 } StorageWritePosix;
 
 /***********************************************************************************************************************************
@@ -46,11 +56,19 @@ Macros for function logging
 /***********************************************************************************************************************************
 File open constants
 
-Since open is called more than once use constants to make sure these parameters are always the same
+Since open is called more than once use constants to make sure these parameters are always the same. A file written without
+truncating must already exist.
 ***********************************************************************************************************************************/
 #define FILE_OPEN_FLAGS                                             (O_CREAT | O_TRUNC | O_WRONLY)
+#define FILE_OPEN_FLAGS_NO_TRUNCATE                                 (O_WRONLY)
 #define FILE_OPEN_PURPOSE                                           "write"
 
+/***********************************************************************************************************************************
+Size of the blocks checked for zeroes when writing a sparse file. This matches the smallest common file system block size so holes
+can be allocated for any zero block found.
+***********************************************************************************************************************************/
+#define STORAGE_WRITE_POSIX_SPARSE_BLOCK                            4096
+
 /***********************************************************************************************************************************
 Close file descriptor
 ***********************************************************************************************************************************/
@@ -76,7 +94,8 @@ storageWritePosixOpen(THIS_VOID)
     ASSERT(this->fd == -1);
 
     // Open the file
-    this->fd = open(strZ(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile);
+    const int flags = this->noTruncate ? FILE_OPEN_FLAGS_NO_TRUNCATE : FILE_OPEN_FLAGS;
+    this->fd = open(strZ(this->nameTmp), flags, this->interface.modeFile);
 
     // Attempt to create the path if it is missing
     if (this->fd == -1 && errno == ENOENT && this->interface.createPath)                                            // {vm_covered}
@@ -85,7 +104,7 @@ storageWritePosixOpen(THIS_VOID)
         storageInterfacePathCreateP(this->storage, this->path, false, false, this->interface.modePath);
 
         // Open file again
-        this->fd = open(strZ(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile);
+        this->fd = open(strZ(this->nameTmp), flags, this->interface.modeFile);
     }
 
     // Handle errors
@@ -100,6 +119,14 @@ storageWritePosixOpen(THIS_VOID)
     // Set free callback to ensure the file descriptor is freed
     memContextCallbackSet(this->memContext, storageWritePosixFreeResource, this);
 
+    // Move to the offset where writing starts
+    if (this->size != 0)
+    {
+        THROW_ON_SYS_ERROR_FMT(
+            lseek(this->fd, (off_t)this->size, SEEK_SET) == -1, FileWriteError, "unable to seek to %" PRIu64 " in '%s'",
+            this->size, strZ(this->nameTmp));
+    }
+
     // Update user/group owner
     if (this->interface.user != NULL || this->interface.group != NULL)
     {
@@ -121,6 +148,78 @@ storageWritePosixOpen(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Is the block all zeroes? Comparing the block to itself offset by one byte lets memcmp() do the scan with vector instructions.
+***********************************************************************************************************************************/
+static bool
+storageWritePosixZero(const unsigned char *block, size_t blockSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(UCHARDATA, block);
+        FUNCTION_TEST_PARAM(SIZE, blockSize);
+    FUNCTION_TEST_END();
+
+    ASSERT(block != NULL);
+    ASSERT(blockSize > 0);
+
+    FUNCTION_TEST_RETURN(block[0] == 0 && memcmp(block, block + 1, blockSize - 1) == 0);
+}
+
+/***********************************************************************************************************************************
+Write to a sparse file. Runs of non-zero blocks are written with a single call at their offset and zero blocks are skipped, leaving
+holes that read back as zeroes. The file is extended to its full size on close in case it ends with a hole.
+***********************************************************************************************************************************/
+static void
+storageWritePosixSparse(StorageWritePosix *this, const Buffer *buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL);
+
+    const unsigned char *const data = bufPtrConst(buffer);
+    size_t dataBegin = 0;
+    size_t blockBegin = 0;
+
+    while (blockBegin < bufUsed(buffer))
+    {
+        size_t blockSize = bufUsed(buffer) - blockBegin;
+
+        if (blockSize > STORAGE_WRITE_POSIX_SPARSE_BLOCK)
+            blockSize = STORAGE_WRITE_POSIX_SPARSE_BLOCK;
+
+        // On a zero block write any data found before it and start the next run of data after it
+        if (storageWritePosixZero(data + blockBegin, blockSize))
+        {
+            if (blockBegin > dataBegin)
+            {
+                const size_t dataSize = blockBegin - dataBegin;
+
+                if (pwrite(this->fd, data + dataBegin, dataSize, (off_t)(this->size + dataBegin)) != (ssize_t)dataSize)
+                    THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+            }
+
+            dataBegin = blockBegin + blockSize;
+        }
+
+        blockBegin += blockSize;
+    }
+
+    // Write data remaining at the end of the buffer
+    if (bufUsed(buffer) > dataBegin)
+    {
+        const size_t dataSize = bufUsed(buffer) - dataBegin;
+
+        if (pwrite(this->fd, data + dataBegin, dataSize, (off_t)(this->size + dataBegin)) != (ssize_t)dataSize)
+            THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Write to the file
 ***********************************************************************************************************************************/
@@ -139,9 +238,27 @@ storageWritePosix(THIS_VOID, const Buffer *buffer)
     ASSERT(this->fd != -1);
 
     // Write the data
-    if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
+    if (this->sparse)
+        storageWritePosixSparse(this, buffer);
+    else if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
         THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
 
+    // Start writeback of the data just written without waiting for it so the device writes the data while the next buffer is
+    // produced and a later sync has less to wait for. Then drop the data from the page cache since it will not be read again soon.
+    // Failures are ignored since these are only hints.
+    if (this->writeBehind)
+    {
+#ifdef SYNC_FILE_RANGE_WRITE
+        sync_file_range(this->fd, (off_t)this->size, (off_t)bufUsed(buffer), SYNC_FILE_RANGE_WRITE);
+#endif
+
+#ifdef POSIX_FADV_DONTNEED
+        posix_fadvise(this->fd, (off_t)this->size, (off_t)bufUsed(buffer), POSIX_FADV_DONTNEED);
+#endif
+    }
+
+    this->size += bufUsed(buffer);
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -162,6 +279,13 @@ storageWritePosixClose(THIS_VOID)
     // Close if the file has not already been closed
     if (this->fd != -1)
     {
+        // Set the size of a sparse file since a trailing hole is not written
+        if (this->sparse)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                ftruncate(this->fd, (off_t)this->size) == -1, FileWriteError, "unable to truncate '%s'", strZ(this->nameTmp));
+        }
+
         // Sync the file
         if (this->interface.syncFile)
             THROW_ON_SYS_ERROR_FMT(fsync(this->fd) == -1, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
@@ -217,7 +341,8 @@ storageWritePosixFd(const THIS_VOID)
 StorageWrite *
 storageWritePosixNew(
     StoragePosix *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
-    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic)
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool sparse, bool writeBehind, bool noTruncate,
+    uint64_t offset)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_POSIX, storage);
@@ -231,12 +356,18 @@ storageWritePosixNew(
         FUNCTION_LOG_PARAM(BOOL, syncFile);
         FUNCTION_LOG_PARAM(BOOL, syncPath);
         FUNCTION_LOG_PARAM(BOOL, atomic);
+        FUNCTION_LOG_PARAM(BOOL, sparse);
+        FUNCTION_LOG_PARAM(BOOL, writeBehind);
+        FUNCTION_LOG_PARAM(BOOL, noTruncate);
+        FUNCTION_LOG_PARAM(UINT64, offset);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
     ASSERT(modeFile != 0);
     ASSERT(modePath != 0);
+    ASSERT(!noTruncate || (!atomic && !sparse));
+    ASSERT(offset == 0 || noTruncate);
 
     StorageWrite *this = NULL;
 
@@ -250,6 +381,10 @@ storageWritePosixNew(
             .storage = storage,
             .path = strPath(name),
             .fd = -1,
+            .size = offset,
+            .sparse = sparse,
+            .writeBehind = writeBehind,
+            .noTruncate = noTruncate,
 
             .interface = (StorageWriteInterface)
             {
@@ -12,6 +12,7 @@ Constructors
 ***********************************************************************************************************************************/
 StorageWrite *storageWritePosixNew(
     StoragePosix *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
-    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic);
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool sparse, bool writeBehind, bool noTruncate,
+    uint64_t offset);
 
 #endif
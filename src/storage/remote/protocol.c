@@ -3,10 +3,12 @@ Remote Storage Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/archive/walTail.h"
 #include "command/backup/pageChecksum.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
+#include "common/crypto/hashBlock.h"
 #include "common/debug.h"
 #include "common/io/filter/sink.h"
 #include "common/io/filter/size.h"
@@ -76,12 +78,16 @@ storageRemoteFilterGroup(IoFilterGroup *filterGroup, const Variant *filterList)
             ioFilterGroupAdd(filterGroup, cipherBlockNewVar(filterParam));
         else if (strEq(filterKey, CRYPTO_HASH_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, cryptoHashNewVar(filterParam));
+        else if (strEq(filterKey, CRYPTO_HASH_BLOCK_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, cryptoHashBlockNewVar(filterParam));
         else if (strEq(filterKey, PAGE_CHECKSUM_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, pageChecksumNewVar(filterParam));
         else if (strEq(filterKey, SINK_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, ioSinkNew());
         else if (strEq(filterKey, SIZE_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, ioSizeNew());
+        else if (strEq(filterKey, WAL_TAIL_PAD_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, walTailPadNew());
         else
             THROW_FMT(AssertError, "unable to add filter '%s'", strZ(filterKey));
     }
@@ -209,7 +215,9 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             {
                 Buffer *buffer = bufNew(ioBufferSize());
 
-                // Write file out to protocol layer
+                // Write file out to protocol layer. Blocks are streamed without waiting for the client so the connection acts as
+                // the read-ahead window. Blocks are not flushed individually since that would send the small remainder of each
+                // block separately -- the protocol write buffer is written whenever it fills and is flushed after the last block.
                 do
                 {
                     ioRead(fileRead, buffer);
@@ -218,7 +226,6 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
                     {
                         ioWriteStrLine(protocolServerIoWrite(server), strNewFmt(PROTOCOL_BLOCK_HEADER "%zu", bufUsed(buffer)));
                         ioWrite(protocolServerIoWrite(server), buffer);
-                        ioWriteFlush(protocolServerIoWrite(server));
 
                         bufUsedZero(buffer);
                     }
@@ -214,6 +214,7 @@ storageRemoteNewWrite(
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
+    ASSERT(!param.noTruncate);
 
     FUNCTION_LOG_RETURN(
         STORAGE_WRITE,
@@ -14,6 +14,7 @@ S3 Storage
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
+#include "common/type/convert.h"
 #include "common/type/object.h"
 #include "common/type/json.h"
 #include "common/type/xml.h"
@@ -44,8 +45,13 @@ S3 query tokens
 STRING_STATIC(S3_QUERY_CONTINUATION_TOKEN_STR,                      "continuation-token");
 STRING_STATIC(S3_QUERY_DELETE_STR,                                  "delete");
 STRING_STATIC(S3_QUERY_DELIMITER_STR,                               "delimiter");
+STRING_STATIC(S3_QUERY_KEY_MARKER_STR,                              "key-marker");
 STRING_STATIC(S3_QUERY_LIST_TYPE_STR,                               "list-type");
+STRING_STATIC(S3_QUERY_PART_NUMBER_MARKER_STR,                      "part-number-marker");
 STRING_STATIC(S3_QUERY_PREFIX_STR,                                  "prefix");
+STRING_EXTERN(S3_QUERY_UPLOAD_ID_STR,                               S3_QUERY_UPLOAD_ID);
+STRING_STATIC(S3_QUERY_UPLOAD_ID_MARKER_STR,                        "upload-id-marker");
+STRING_EXTERN(S3_QUERY_UPLOADS_STR,                                 S3_QUERY_UPLOADS);
 
 STRING_STATIC(S3_QUERY_VALUE_LIST_TYPE_2_STR,                       "2");
 
@@ -57,14 +63,23 @@ STRING_STATIC(S3_XML_TAG_COMMON_PREFIXES_STR,                       "CommonPrefi
 STRING_STATIC(S3_XML_TAG_CONTENTS_STR,                              "Contents");
 STRING_STATIC(S3_XML_TAG_DELETE_STR,                                "Delete");
 STRING_STATIC(S3_XML_TAG_ERROR_STR,                                 "Error");
+STRING_EXTERN(S3_XML_TAG_ETAG_STR,                                  S3_XML_TAG_ETAG);
+STRING_STATIC(S3_XML_TAG_IS_TRUNCATED_STR,                          "IsTruncated");
 STRING_STATIC(S3_XML_TAG_KEY_STR,                                   "Key");
 STRING_STATIC(S3_XML_TAG_LAST_MODIFIED_STR,                         "LastModified");
 STRING_STATIC(S3_XML_TAG_MESSAGE_STR,                               "Message");
 STRING_STATIC(S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR,               "NextContinuationToken");
+STRING_STATIC(S3_XML_TAG_NEXT_KEY_MARKER_STR,                       "NextKeyMarker");
+STRING_STATIC(S3_XML_TAG_NEXT_PART_NUMBER_MARKER_STR,               "NextPartNumberMarker");
+STRING_STATIC(S3_XML_TAG_NEXT_UPLOAD_ID_MARKER_STR,                 "NextUploadIdMarker");
 STRING_STATIC(S3_XML_TAG_OBJECT_STR,                                "Object");
+STRING_EXTERN(S3_XML_TAG_PART_STR,                                  S3_XML_TAG_PART);
+STRING_EXTERN(S3_XML_TAG_PART_NUMBER_STR,                           S3_XML_TAG_PART_NUMBER);
 STRING_STATIC(S3_XML_TAG_PREFIX_STR,                                "Prefix");
 STRING_STATIC(S3_XML_TAG_QUIET_STR,                                 "Quiet");
 STRING_STATIC(S3_XML_TAG_SIZE_STR,                                  "Size");
+STRING_STATIC(S3_XML_TAG_UPLOAD_STR,                                "Upload");
+STRING_EXTERN(S3_XML_TAG_UPLOAD_ID_STR,                             S3_XML_TAG_UPLOAD_ID);
 
 /***********************************************************************************************************************************
 Constants for automatically fetching the current role and credentials
@@ -118,6 +133,7 @@ struct StorageS3
     size_t partSize;                                                // Part size for multi-part upload
     unsigned int deleteMax;                                         // Maximum objects that can be deleted in one request
     StorageS3UriStyle uriStyle;                                     // Path or host style URIs
+    bool uploadDenied;                                              // Was access to unfinished uploads denied?
     const String *bucketEndpoint;                                   // Set to {bucket}.{endpoint}
 
     // For retrieving temporary security credentials
@@ -434,6 +450,7 @@ storageS3Response(HttpRequest *request, StorageS3ResponseParam param)
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, param.allowForbidden);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
     FUNCTION_LOG_END();
 
@@ -447,8 +464,12 @@ storageS3Response(HttpRequest *request, StorageS3ResponseParam param)
         result = httpRequestResponse(request, !param.contentIo);
 
         // Error if the request was not successful
-        if (!httpResponseCodeOk(result) && (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND))
+        if (!httpResponseCodeOk(result) &&
+            (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND) &&
+            (!param.allowForbidden || httpResponseCode(result) != HTTP_RESPONSE_CODE_FORBIDDEN))
+        {
             httpRequestError(request, result);
+        }
 
         // Move response to the prior context
         httpResponseMove(result, memContextPrior());
@@ -468,6 +489,7 @@ storageS3Request(StorageS3 *this, const String *verb, const String *path, Storag
         FUNCTION_LOG_PARAM(HTTP_QUERY, param.query);
         FUNCTION_LOG_PARAM(BUFFER, param.content);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, param.allowForbidden);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
     FUNCTION_LOG_END();
 
@@ -475,7 +497,218 @@ storageS3Request(StorageS3 *this, const String *verb, const String *path, Storag
         HTTP_RESPONSE,
         storageS3ResponseP(
             storageS3RequestAsyncP(this, verb, path, .query = param.query, .content = param.content),
-            .allowMissing = param.allowMissing, .contentIo = param.contentIo));
+            .allowMissing = param.allowMissing, .allowForbidden = param.allowForbidden, .contentIo = param.contentIo));
+}
+
+/***********************************************************************************************************************************
+Perform a request to manage unfinished multipart uploads
+
+These requests need permissions that older repository policies do not grant. When S3 denies one of them a warning is logged and the
+management of unfinished uploads is skipped for the rest of the command, i.e. there is nothing to resume or abort. NULL is returned
+when the request is skipped or denied.
+***********************************************************************************************************************************/
+static HttpResponse *
+storageS3UploadRequest(StorageS3 *this, const String *verb, const String *path, const HttpQuery *query, bool allowMissing)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(path != NULL);
+    ASSERT(query != NULL);
+
+    HttpResponse *result = NULL;
+
+    if (!this->uploadDenied)
+    {
+        result = storageS3RequestP(this, verb, path, .query = query, .allowMissing = allowMissing, .allowForbidden = true);
+
+        if (httpResponseCode(result) == HTTP_RESPONSE_CODE_FORBIDDEN)
+        {
+            LOG_WARN(
+                "access denied to unfinished S3 uploads so they will not be resumed or aborted\n"
+                "HINT: does the repository policy allow s3:ListBucketMultipartUploads, s3:ListMultipartUploadParts, and"
+                " s3:AbortMultipartUpload?");
+
+            this->uploadDenied = true;
+            httpResponseFree(result);
+            result = NULL;
+        }
+    }
+
+    FUNCTION_LOG_RETURN(HTTP_RESPONSE, result);
+}
+
+/**********************************************************************************************************************************/
+void
+storageS3UploadList(StorageS3 *this, const String *prefix, StorageS3UploadListCallback *callback, void *callbackData)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, prefix);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(prefix != NULL);
+    ASSERT(callback != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        HttpQuery *query = httpQueryAdd(httpQueryNewP(), S3_QUERY_UPLOADS_STR, EMPTY_STR);
+
+        // Don't specify empty prefix because it is the default
+        if (!strEmpty(prefix))
+            httpQueryAdd(query, S3_QUERY_PREFIX_STR, prefix);
+
+        // Loop as long as the list is truncated
+        bool truncated = false;
+
+        do
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                HttpResponse *response = storageS3UploadRequest(this, HTTP_VERB_GET_STR, FSLASH_STR, query, false);
+                truncated = false;
+
+                if (response != NULL)
+                {
+                    XmlNode *xmlRoot = xmlDocumentRoot(xmlDocumentNewBuf(httpResponseContent(response)));
+
+                    // Pass each upload to the callback
+                    XmlNodeList *uploadList = xmlNodeChildList(xmlRoot, S3_XML_TAG_UPLOAD_STR);
+
+                    for (unsigned int uploadIdx = 0; uploadIdx < xmlNodeLstSize(uploadList); uploadIdx++)
+                    {
+                        const XmlNode *uploadNode = xmlNodeLstGet(uploadList, uploadIdx);
+
+                        callback(
+                            this, callbackData, xmlNodeContent(xmlNodeChild(uploadNode, S3_XML_TAG_KEY_STR, true)),
+                            xmlNodeContent(xmlNodeChild(uploadNode, S3_XML_TAG_UPLOAD_ID_STR, true)));
+                    }
+
+                    // If the list is truncated then continue after the last upload returned
+                    truncated = strEq(xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_IS_TRUNCATED_STR, false)), TRUE_STR);
+
+                    if (truncated)
+                    {
+                        httpQueryPut(
+                            query, S3_QUERY_KEY_MARKER_STR,
+                            xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_KEY_MARKER_STR, true)));
+                        httpQueryPut(
+                            query, S3_QUERY_UPLOAD_ID_MARKER_STR,
+                            xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_UPLOAD_ID_MARKER_STR, true)));
+                    }
+                }
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+        while (truncated);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+KeyValue *
+storageS3UploadPartList(StorageS3 *this, const String *key, const String *uploadId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, key);
+        FUNCTION_LOG_PARAM(STRING, uploadId);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(key != NULL);
+    ASSERT(uploadId != NULL);
+
+    KeyValue *result = kvNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *path = strNewFmt("/%s", strZ(key));
+        HttpQuery *query = httpQueryAdd(httpQueryNewP(), S3_QUERY_UPLOAD_ID_STR, uploadId);
+
+        // Loop as long as the list is truncated
+        bool truncated = false;
+
+        do
+        {
+            // The upload may be gone if it was completed or aborted by another process
+            HttpResponse *response = storageS3UploadRequest(this, HTTP_VERB_GET_STR, path, query, true);
+            truncated = false;
+
+            if (response == NULL || httpResponseCode(response) == HTTP_RESPONSE_CODE_NOT_FOUND)
+            {
+                kvFree(result);
+                result = NULL;
+            }
+            else
+            {
+                XmlNode *xmlRoot = xmlDocumentRoot(xmlDocumentNewBuf(httpResponseContent(response)));
+                XmlNodeList *partList = xmlNodeChildList(xmlRoot, S3_XML_TAG_PART_STR);
+
+                for (unsigned int partIdx = 0; partIdx < xmlNodeLstSize(partList); partIdx++)
+                {
+                    const XmlNode *partNode = xmlNodeLstGet(partList, partIdx);
+
+                    kvPut(
+                        result,
+                        VARUINT(cvtZToUInt(strZ(xmlNodeContent(xmlNodeChild(partNode, S3_XML_TAG_PART_NUMBER_STR, true))))),
+                        VARSTR(xmlNodeContent(xmlNodeChild(partNode, S3_XML_TAG_ETAG_STR, true))));
+                }
+
+                // If the list is truncated then continue after the last part returned
+                truncated = strEq(xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_IS_TRUNCATED_STR, false)), TRUE_STR);
+
+                if (truncated)
+                {
+                    httpQueryPut(
+                        query, S3_QUERY_PART_NUMBER_MARKER_STR,
+                        xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_PART_NUMBER_MARKER_STR, true)));
+                }
+            }
+        }
+        while (truncated);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(KEY_VALUE, result);
+}
+
+/**********************************************************************************************************************************/
+void
+storageS3UploadAbort(StorageS3 *this, const String *key, const String *uploadId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, key);
+        FUNCTION_LOG_PARAM(STRING, uploadId);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(key != NULL);
+    ASSERT(uploadId != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // The upload may already be gone if it was completed or aborted by another process, which is fine
+        storageS3UploadRequest(
+            this, HTTP_VERB_DELETE_STR, strNewFmt("/%s", strZ(key)),
+            httpQueryAdd(httpQueryNewP(), S3_QUERY_UPLOAD_ID_STR, uploadId), true);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
 }
 
 /***********************************************************************************************************************************
@@ -767,7 +1000,7 @@ storageS3NewWrite(THIS_VOID, const String *file, StorageInterfaceNewWriteParam p
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE_S3, this);
         FUNCTION_LOG_PARAM(STRING, file);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(BOOL, param.resume);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
@@ -776,8 +1009,9 @@ storageS3NewWrite(THIS_VOID, const String *file, StorageInterfaceNewWriteParam p
     ASSERT(param.user == NULL);
     ASSERT(param.group == NULL);
     ASSERT(param.timeModified == 0);
+    ASSERT(!param.noTruncate);
 
-    FUNCTION_LOG_RETURN(STORAGE_WRITE, storageWriteS3New(this, file, this->partSize));
+    FUNCTION_LOG_RETURN(STORAGE_WRITE, storageWriteS3New(this, file, this->partSize, param.resume));
 }
 
 /**********************************************************************************************************************************/
@@ -838,6 +1072,52 @@ storageS3PathRemoveInternal(StorageS3 *this, HttpRequest *request, XmlDocument *
     FUNCTION_TEST_RETURN(result);
 }
 
+// Add a key to the delete request and send the request when it is full
+static void
+storageS3PathRemoveAdd(StorageS3 *this, StorageS3PathRemoveData *data, const String *key)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_S3, this);
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, key);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(data != NULL);
+    ASSERT(key != NULL);
+
+    // If there is something to delete then create the request
+    if (data->xml == NULL)
+    {
+        MEM_CONTEXT_BEGIN(data->memContext)
+        {
+            data->xml = xmlDocumentNew(S3_XML_TAG_DELETE_STR);
+            xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(data->xml), S3_XML_TAG_QUIET_STR), TRUE_STR);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    // Add to delete list
+    xmlNodeContentSet(xmlNodeAdd(xmlNodeAdd(xmlDocumentRoot(data->xml), S3_XML_TAG_OBJECT_STR), S3_XML_TAG_KEY_STR), key);
+    data->size++;
+
+    // Delete list when it is full
+    if (data->size == this->deleteMax)
+    {
+        MEM_CONTEXT_BEGIN(data->memContext)
+        {
+            data->request = storageS3PathRemoveInternal(this, data->request, data->xml);
+        }
+        MEM_CONTEXT_END();
+
+        xmlDocumentFree(data->xml);
+        data->xml = NULL;
+        data->size = 0;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 static void
 storageS3PathRemoveCallback(StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlNode *xml)
 {
@@ -857,39 +1137,27 @@ storageS3PathRemoveCallback(StorageS3 *this, void *callbackData, const String *n
     {
         ASSERT(xml != NULL);
 
-        StorageS3PathRemoveData *data = (StorageS3PathRemoveData *)callbackData;
+        storageS3PathRemoveAdd(
+            this, (StorageS3PathRemoveData *)callbackData, xmlNodeContent(xmlNodeChild(xml, S3_XML_TAG_KEY_STR, true)));
+    }
 
-        // If there is something to delete then create the request
-        if (data->xml == NULL)
-        {
-            MEM_CONTEXT_BEGIN(data->memContext)
-            {
-                data->xml = xmlDocumentNew(S3_XML_TAG_DELETE_STR);
-                xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(data->xml), S3_XML_TAG_QUIET_STR), TRUE_STR);
-            }
-            MEM_CONTEXT_END();
-        }
+    FUNCTION_TEST_RETURN_VOID();
+}
 
-        // Add to delete list
-        xmlNodeContentSet(
-            xmlNodeAdd(xmlNodeAdd(xmlDocumentRoot(data->xml), S3_XML_TAG_OBJECT_STR), S3_XML_TAG_KEY_STR),
-            xmlNodeContent(xmlNodeChild(xml, S3_XML_TAG_KEY_STR, true)));
-        data->size++;
+// Abort uploads that were never completed so their parts do not linger after the path is removed
+static void
+storageS3PathRemoveUploadCallback(StorageS3 *this, void *callbackData, const String *key, const String *uploadId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_S3, this);
+        (void)callbackData;                                         // No callback data is used
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(STRING, uploadId);
+    FUNCTION_TEST_END();
 
-        // Delete list when it is full
-        if (data->size == this->deleteMax)
-        {
-            MEM_CONTEXT_BEGIN(data->memContext)
-            {
-                data->request = storageS3PathRemoveInternal(this, data->request, data->xml);
-            }
-            MEM_CONTEXT_END();
+    ASSERT(this != NULL);
 
-            xmlDocumentFree(data->xml);
-            data->xml = NULL;
-            data->size = 0;
-        }
-    }
+    storageS3UploadAbort(this, key, uploadId);
 
     FUNCTION_TEST_RETURN_VOID();
 }
@@ -920,6 +1188,11 @@ storageS3PathRemove(THIS_VOID, const String *path, bool recurse, StorageInterfac
 
         // Check response on last async request
         storageS3PathRemoveInternal(this, data.request, NULL);
+
+        // Abort uploads in the path left unfinished by writes that were interrupted
+        storageS3UploadList(
+            this, strSize(path) == 1 ? EMPTY_STR : strNewFmt("%s/", strZ(strSub(path, 1))), storageS3PathRemoveUploadCallback,
+            NULL);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -947,6 +1220,44 @@ storageS3Remove(THIS_VOID, const String *file, StorageInterfaceRemoveParam param
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+static void
+storageS3RemoveList(THIS_VOID, const String *path, const StringList *fileList, StorageInterfaceRemoveListParam param)
+{
+    THIS(StorageS3);
+
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(STRING_LIST, fileList);
+        (void)param;                                                // No parameters are used
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+    ASSERT(fileList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Keys do not begin with / so strip it from the path
+        const String *keyPrefix = strEq(path, FSLASH_STR) ? EMPTY_STR : strNewFmt("%s/", strZ(strSub(path, 1)));
+        StorageS3PathRemoveData data = {.memContext = memContextCurrent()};
+
+        for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+            storageS3PathRemoveAdd(this, &data, strNewFmt("%s%s", strZ(keyPrefix), strZ(strLstGet(fileList, fileIdx))));
+
+        // Call if there is more to be removed
+        if (data.xml != NULL)
+            data.request = storageS3PathRemoveInternal(this, data.request, data.xml);
+
+        // Check response on last async request
+        storageS3PathRemoveInternal(this, data.request, NULL);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfaceS3 =
 {
@@ -956,6 +1267,7 @@ static const StorageInterface storageInterfaceS3 =
     .newWrite = storageS3NewWrite,
     .pathRemove = storageS3PathRemove,
     .remove = storageS3Remove,
+    .removeList = storageS3RemoveList,
 };
 
 Storage *
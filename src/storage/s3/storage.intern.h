@@ -10,8 +10,29 @@ Object type
 typedef struct StorageS3 StorageS3;
 
 #include "common/io/http/request.h"
+#include "common/type/keyValue.h"
 #include "storage/s3/storage.h"
 
+/***********************************************************************************************************************************
+S3 query tokens
+***********************************************************************************************************************************/
+#define S3_QUERY_UPLOAD_ID                                          "uploadId"
+    STRING_DECLARE(S3_QUERY_UPLOAD_ID_STR);
+#define S3_QUERY_UPLOADS                                            "uploads"
+    STRING_DECLARE(S3_QUERY_UPLOADS_STR);
+
+/***********************************************************************************************************************************
+XML tags
+***********************************************************************************************************************************/
+#define S3_XML_TAG_ETAG                                             "ETag"
+    STRING_DECLARE(S3_XML_TAG_ETAG_STR);
+#define S3_XML_TAG_PART                                             "Part"
+    STRING_DECLARE(S3_XML_TAG_PART_STR);
+#define S3_XML_TAG_PART_NUMBER                                      "PartNumber"
+    STRING_DECLARE(S3_XML_TAG_PART_NUMBER_STR);
+#define S3_XML_TAG_UPLOAD_ID                                        "UploadId"
+    STRING_DECLARE(S3_XML_TAG_UPLOAD_ID_STR);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -33,6 +54,7 @@ typedef struct StorageS3ResponseParam
 {
     VAR_PARAM_HEADER;
     bool allowMissing;                                              // Allow missing files (caller can check response code)
+    bool allowForbidden;                                            // Allow forbidden requests (caller can check response code)
     bool contentIo;                                                 // Is IoRead interface required to read content?
 } StorageS3ResponseParam;
 
@@ -48,6 +70,7 @@ typedef struct StorageS3RequestParam
     const HttpQuery *query;                                         // Query parameters
     const Buffer *content;                                          // Request content
     bool allowMissing;                                              // Allow missing files (caller can check response code)
+    bool allowForbidden;                                            // Allow forbidden requests (caller can check response code)
     bool contentIo;                                                 // Is IoRead interface required to read content?
 } StorageS3RequestParam;
 
@@ -56,6 +79,19 @@ typedef struct StorageS3RequestParam
 
 HttpResponse *storageS3Request(StorageS3 *this, const String *verb, const String *path, StorageS3RequestParam param);
 
+// List multipart uploads that were started but not completed or aborted for keys beginning with the prefix. Uploads are passed to
+// the callback ordered by key and then by the time they were started.
+typedef void StorageS3UploadListCallback(StorageS3 *this, void *callbackData, const String *key, const String *uploadId);
+
+void storageS3UploadList(StorageS3 *this, const String *prefix, StorageS3UploadListCallback *callback, void *callbackData);
+
+// Get the ETags of parts already uploaded keyed by part number. NULL is returned when the upload no longer exists or when the parts
+// cannot be listed.
+KeyValue *storageS3UploadPartList(StorageS3 *this, const String *key, const String *uploadId);
+
+// Abort a multipart upload and free the parts already uploaded
+void storageS3UploadAbort(StorageS3 *this, const String *key, const String *uploadId);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
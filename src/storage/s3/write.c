@@ -3,9 +3,11 @@ S3 Storage File Write
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "common/crypto/hash.h"
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/type/keyValue.h"
 #include "common/type/object.h"
 #include "common/type/xml.h"
 #include "storage/s3/write.h"
@@ -15,17 +17,11 @@ S3 Storage File Write
 S3 query tokens
 ***********************************************************************************************************************************/
 STRING_STATIC(S3_QUERY_PART_NUMBER_STR,                             "partNumber");
-STRING_STATIC(S3_QUERY_UPLOADS_STR,                                 "uploads");
-STRING_STATIC(S3_QUERY_UPLOAD_ID_STR,                               "uploadId");
 
 /***********************************************************************************************************************************
 XML tags
 ***********************************************************************************************************************************/
-STRING_STATIC(S3_XML_TAG_ETAG_STR,                                  "ETag");
-STRING_STATIC(S3_XML_TAG_UPLOAD_ID_STR,                             "UploadId");
 STRING_STATIC(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR,             "CompleteMultipartUpload");
-STRING_STATIC(S3_XML_TAG_PART_STR,                                  "Part");
-STRING_STATIC(S3_XML_TAG_PART_NUMBER_STR,                           "PartNumber");
 
 /***********************************************************************************************************************************
 Object type
@@ -41,6 +37,10 @@ typedef struct StorageWriteS3
     Buffer *partBuffer;
     const String *uploadId;
     StringList *uploadPartList;
+
+    bool resume;                                                    // Resume an unfinished upload of the same file?
+    StringList *resumeUploadIdList;                                 // Unfinished uploads of the file found when resuming
+    KeyValue *resumePartKv;                                         // ETags of parts uploaded before resume by part number
 } StorageWriteS3;
 
 /***********************************************************************************************************************************
@@ -102,6 +102,86 @@ storageWriteS3Part(StorageWriteS3 *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Find an unfinished upload of the file to resume and load the parts that were already uploaded
+***********************************************************************************************************************************/
+static void
+storageWriteS3ResumeCallback(StorageS3 *storage, void *callbackData, const String *key, const String *uploadId)
+{
+    FUNCTION_TEST_BEGIN();
+        (void)storage;                                              // Storage is also available from the write object
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(STRING, uploadId);
+    FUNCTION_TEST_END();
+
+    ASSERT(callbackData != NULL);
+
+    StorageWriteS3 *this = callbackData;
+
+    // The list is by prefix so skip uploads of other files that begin with the same name
+    if (strEq(key, strSub(this->interface.name, 1)))
+        strLstAdd(this->resumeUploadIdList, uploadId);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static void
+storageWriteS3Resume(StorageWriteS3 *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_S3, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->uploadId == NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *key = strSub(this->interface.name, 1);
+
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->resumeUploadIdList = strLstNew();
+        }
+        MEM_CONTEXT_END();
+
+        storageS3UploadList(this->storage, key, storageWriteS3ResumeCallback, this);
+
+        if (!strLstEmpty(this->resumeUploadIdList))
+        {
+            // Resume the upload started last since it is the most likely to have the current content. Abort the others since they
+            // have been abandoned.
+            unsigned int uploadIdx = strLstSize(this->resumeUploadIdList) - 1;
+
+            for (unsigned int abortIdx = 0; abortIdx < uploadIdx; abortIdx++)
+                storageS3UploadAbort(this->storage, key, strLstGet(this->resumeUploadIdList, abortIdx));
+
+            const String *uploadId = strLstGet(this->resumeUploadIdList, uploadIdx);
+
+            // Get the parts already uploaded. If they cannot be listed then a new upload will be initiated instead.
+            KeyValue *resumePartKv = storageS3UploadPartList(this->storage, key, uploadId);
+
+            if (resumePartKv != NULL)
+            {
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->uploadId = strDup(uploadId);
+                    this->uploadPartList = strLstNew();
+                    this->resumePartKv = kvMove(resumePartKv, this->memContext);
+                }
+                MEM_CONTEXT_END();
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Upload the part buffer
+***********************************************************************************************************************************/
 static void
 storageWriteS3PartAsync(StorageWriteS3 *this)
 {
@@ -118,6 +198,10 @@ storageWriteS3PartAsync(StorageWriteS3 *this)
         // Complete prior async request, if any
         storageWriteS3Part(this);
 
+        // Find an unfinished upload to resume
+        if (this->resume && this->resumeUploadIdList == NULL)
+            storageWriteS3Resume(this);
+
         // Get the upload id if we have not already
         if (this->uploadId == NULL)
         {
@@ -138,17 +222,31 @@ storageWriteS3PartAsync(StorageWriteS3 *this)
             MEM_CONTEXT_END();
         }
 
-        // Upload the part async
-        HttpQuery *query = httpQueryNewP();
-        httpQueryAdd(query, S3_QUERY_UPLOAD_ID_STR, this->uploadId);
-        httpQueryAdd(query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", strLstSize(this->uploadPartList) + 1));
+        // If the part was uploaded before resume with the same content then reuse it. The ETag of a part is the MD5 of the content
+        // so a part that differs in any way is uploaded again, as is every part when server-side encryption makes the ETag
+        // something other than the MD5.
+        const unsigned int partNo = strLstSize(this->uploadPartList) + 1;
+        const String *resumeETag = this->resumePartKv != NULL ? varStr(kvGet(this->resumePartKv, VARUINT(partNo))) : NULL;
 
-        MEM_CONTEXT_BEGIN(this->memContext)
+        if (resumeETag != NULL &&
+            strEq(resumeETag, strNewFmt("\"%s\"", strZ(bufHex(cryptoHashOne(HASH_TYPE_MD5_STR, this->partBuffer))))))
         {
-            this->request = storageS3RequestAsyncP(
-                this->storage, HTTP_VERB_PUT_STR, this->interface.name, .query = query, .content = this->partBuffer);
+            strLstAdd(this->uploadPartList, resumeETag);
+        }
+        // Else upload the part async
+        else
+        {
+            HttpQuery *query = httpQueryNewP();
+            httpQueryAdd(query, S3_QUERY_UPLOAD_ID_STR, this->uploadId);
+            httpQueryAdd(query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", partNo));
+
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->request = storageS3RequestAsyncP(
+                    this->storage, HTTP_VERB_PUT_STR, this->interface.name, .query = query, .content = this->partBuffer);
+            }
+            MEM_CONTEXT_END();
         }
-        MEM_CONTEXT_END();
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -255,11 +353,13 @@ storageWriteS3Close(THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageWrite *
-storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
+storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize, bool resume)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(SIZE, partSize);
+        FUNCTION_LOG_PARAM(BOOL, resume);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
@@ -276,6 +376,7 @@ storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
             .partSize = partSize,
+            .resume = resume,
 
             .interface = (StorageWriteInterface)
             {
@@ -10,6 +10,6 @@ S3 Storage File Write
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-StorageWrite *storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize);
+StorageWrite *storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize, bool resume);
 
 #endif
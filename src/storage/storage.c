@@ -171,6 +171,31 @@ storageExists(const Storage *this, const String *pathExp, StorageExistsParam par
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/**********************************************************************************************************************************/
+void
+storageFileSync(const Storage *this, const String *fileExp)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, this);
+        FUNCTION_LOG_PARAM(STRING, fileExp);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->write);
+
+    // Not all storage requires file sync so just do nothing if the function is not implemented
+    if (this->interface.fileSync != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            storageInterfaceFileSyncP(this->driver, storagePathP(this, fileExp));
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 Buffer *
 storageGet(StorageRead *file, StorageGetParam param)
@@ -645,10 +670,17 @@ storageNewWrite(const Storage *this, const String *fileExp, StorageNewWriteParam
         FUNCTION_LOG_PARAM(BOOL, param.noSyncPath);
         FUNCTION_LOG_PARAM(BOOL, param.noAtomic);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(BOOL, param.sparse);
+        FUNCTION_LOG_PARAM(BOOL, param.resume);
+        FUNCTION_LOG_PARAM(BOOL, param.writeBehind);
+        FUNCTION_LOG_PARAM(BOOL, param.noTruncate);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(this->write);
+    ASSERT(!param.noTruncate || (param.noAtomic && !param.sparse));
+    ASSERT(param.offset == 0 || param.noTruncate);
 
     StorageWrite *result = NULL;
 
@@ -659,7 +691,9 @@ storageNewWrite(const Storage *this, const String *fileExp, StorageNewWriteParam
                 this->driver, storagePathP(this, fileExp), .modeFile = param.modeFile != 0 ? param.modeFile : this->modeFile,
                 .modePath = param.modePath != 0 ? param.modePath : this->modePath, .user = param.user, .group = param.group,
                 .timeModified = param.timeModified, .createPath = !param.noCreatePath, .syncFile = !param.noSyncFile,
-                .syncPath = !param.noSyncPath, .atomic = !param.noAtomic, .compressible = param.compressible),
+                .syncPath = !param.noSyncPath, .atomic = !param.noAtomic, .compressible = param.compressible,
+                .sparse = param.sparse, .resume = param.resume, .writeBehind = param.writeBehind, .noTruncate = param.noTruncate,
+                .offset = param.offset),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
@@ -917,6 +951,49 @@ storageRemove(const Storage *this, const String *fileExp, StorageRemoveParam par
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+storageRemoveList(const Storage *this, const String *pathExp, const StringList *fileList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, this);
+        FUNCTION_LOG_PARAM(STRING, pathExp);
+        FUNCTION_LOG_PARAM(STRING_LIST, fileList);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->write);
+    ASSERT(fileList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Build the path
+        String *path = storagePathP(this, pathExp);
+
+        // Call driver function if the driver can remove a list of files
+        if (this->interface.removeList != NULL)
+            storageInterfaceRemoveListP(this->driver, path, fileList);
+        // Else remove files one at a time
+        else
+        {
+            MEM_CONTEXT_TEMP_RESET_BEGIN()
+            {
+                for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+                {
+                    storageInterfaceRemoveP(this->driver, strNewFmt("%s/%s", strZ(path), strZ(strLstGet(fileList, fileIdx))));
+
+                    // Reset the memory context occasionally so we don't use too much memory or slow down processing
+                    MEM_CONTEXT_TEMP_RESET(1000);
+                }
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void *
 storageDriver(const Storage *this)
@@ -76,6 +76,12 @@ typedef struct StorageExistsParam
 
 bool storageExists(const Storage *this, const String *pathExp, StorageExistsParam param);
 
+// Sync a file that was written without a sync
+#define storageFileSyncP(this, fileExp)                                                                                            \
+    storageFileSync(this, fileExp)
+
+void storageFileSync(const Storage *this, const String *fileExp);
+
 // Read from storage into a buffer
 typedef struct StorageGetParam
 {
@@ -167,6 +173,11 @@ typedef struct StorageNewWriteParam
     bool noSyncPath;
     bool noAtomic;
     bool compressible;
+    bool sparse;
+    bool resume;
+    bool writeBehind;
+    bool noTruncate;
+    uint64_t offset;
     mode_t modeFile;
     mode_t modePath;
     time_t timeModified;
@@ -248,6 +259,13 @@ typedef struct StorageRemoveParam
 
 void storageRemove(const Storage *this, const String *fileExp, StorageRemoveParam param);
 
+// Remove a list of files in a path. Missing files are ignored. Storage that supports batch removal (e.g. S3) will remove the files
+// in as few requests as possible.
+#define storageRemoveListP(this, pathExp, fileList)                                                                                \
+    storageRemoveList(this, pathExp, fileList)
+
+void storageRemoveList(const Storage *this, const String *pathExp, const StringList *fileList);
+
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
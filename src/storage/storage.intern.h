@@ -31,6 +31,11 @@ Error messages
 #define STORAGE_ERROR_READ_OPEN                                     "unable to open file '%s' for read"
 #define STORAGE_ERROR_READ_MISSING                                  "unable to open missing file '%s' for read"
 
+#define STORAGE_ERROR_FILE_SYNC                                     "unable to sync file '%s'"
+#define STORAGE_ERROR_FILE_SYNC_CLOSE                               "unable to close file '%s' after sync"
+#define STORAGE_ERROR_FILE_SYNC_OPEN                                "unable to open file '%s' for sync"
+#define STORAGE_ERROR_FILE_SYNC_MISSING                             "unable to sync missing file '%s'"
+
 #define STORAGE_ERROR_INFO                                          "unable to get info for path/file '%s'"
 #define STORAGE_ERROR_INFO_MISSING                                  "unable to get info for missing path/file '%s'"
 
@@ -131,6 +136,22 @@ typedef struct StorageInterfaceNewWriteParam
 
     // Is the file compressible?  This is used when the file must be moved across a network and temporary compression is helpful.
     bool compressible;
+
+    // Skip writing blocks of zeroes so they become holes in the file. Storage that does not support sparse files ignores this.
+    bool sparse;
+
+    // Continue an upload of the same file left unfinished by a prior write, reusing parts with matching content. Storage that does
+    // not upload in parts ignores this.
+    bool resume;
+
+    // Start writeback of data as it is written and drop it from the page cache. This is for bulk data files that will not be read
+    // again soon, e.g. files written by backup and restore. Storage without a page cache ignores this.
+    bool writeBehind;
+
+    // Write into the existing file starting at offset without truncating it so data outside the range written is left intact,
+    // e.g. to rewrite changed blocks of a file in place. Storage that can only replace whole files does not support this.
+    bool noTruncate;
+    uint64_t offset;
 } StorageInterfaceNewWriteParam;
 
 typedef StorageWrite *StorageInterfaceNewWrite(void *thisVoid, const String *file, StorageInterfaceNewWriteParam param);
@@ -222,6 +243,18 @@ typedef void StorageInterfacePathCreate(
     STORAGE_COMMON_INTERFACE(thisVoid).pathCreate(                                                                                 \
         thisVoid, path, errorOnExists, noParentCreate, mode, (StorageInterfacePathCreateParam){VAR_PARAM_INIT, __VA_ARGS__})
 
+// ---------------------------------------------------------------------------------------------------------------------------------
+// Sync a file that was written without a sync
+typedef struct StorageInterfaceFileSyncParam
+{
+    VAR_PARAM_HEADER;
+} StorageInterfaceFileSyncParam;
+
+typedef void StorageInterfaceFileSync(void *thisVoid, const String *file, StorageInterfaceFileSyncParam param);
+
+#define storageInterfaceFileSyncP(thisVoid, file, ...)                                                                             \
+    STORAGE_COMMON_INTERFACE(thisVoid).fileSync(thisVoid, file, (StorageInterfaceFileSyncParam){VAR_PARAM_INIT, __VA_ARGS__})
+
 // ---------------------------------------------------------------------------------------------------------------------------------
 // Sync a path
 typedef struct StorageInterfacePathSyncParam
@@ -234,6 +267,21 @@ typedef void StorageInterfacePathSync(void *thisVoid, const String *path, Storag
 #define storageInterfacePathSyncP(thisVoid, path, ...)                                                                             \
     STORAGE_COMMON_INTERFACE(thisVoid).pathSync(thisVoid, path, (StorageInterfacePathSyncParam){VAR_PARAM_INIT, __VA_ARGS__})
 
+// ---------------------------------------------------------------------------------------------------------------------------------
+// Remove a list of files in a path. Drivers that can remove multiple files in a single request should implement this function,
+// otherwise each file is removed with remove().
+typedef struct StorageInterfaceRemoveListParam
+{
+    VAR_PARAM_HEADER;
+} StorageInterfaceRemoveListParam;
+
+typedef void StorageInterfaceRemoveList(
+    void *thisVoid, const String *path, const StringList *fileList, StorageInterfaceRemoveListParam param);
+
+#define storageInterfaceRemoveListP(thisVoid, path, fileList, ...)                                                                 \
+    STORAGE_COMMON_INTERFACE(thisVoid).removeList(                                                                                 \
+        thisVoid, path, fileList, (StorageInterfaceRemoveListParam){VAR_PARAM_INIT, __VA_ARGS__})
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
@@ -251,9 +299,11 @@ typedef struct StorageInterface
     StorageInterfaceRemove *remove;
 
     // Optional functions
+    StorageInterfaceFileSync *fileSync;
     StorageInterfaceMove *move;
     StorageInterfacePathCreate *pathCreate;
     StorageInterfacePathSync *pathSync;
+    StorageInterfaceRemoveList *removeList;
 } StorageInterface;
 
 #define storageNewP(type, path, modeFile, modePath, write, pathExpressionFunction, driver, ...)                                    \
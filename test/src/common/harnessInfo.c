@@ -28,11 +28,9 @@ typedef struct HarnessInfoChecksumData
 } HarnessInfoChecksumData;
 
 static void
-harnessInfoChecksumCallback(
-    void *callbackData, const String *section, const String *key, const String *value, const Variant *valueVar)
+harnessInfoChecksumCallback(void *callbackData, const String *section, const String *key, const String *value)
 {
     HarnessInfoChecksumData *data = (HarnessInfoChecksumData *)callbackData;
-    (void)valueVar;
 
     // Calculate checksum
     if (data->sectionLast == NULL || !strEq(section, data->sectionLast))
@@ -121,8 +119,8 @@ harnessInfoChecksumZ(const char *info)
 Test callback that logs the results to a string
 ***********************************************************************************************************************************/
 void
-harnessInfoLoadNewCallback(void *callbackData, const String *section, const String *key, const Variant *value)
+harnessInfoLoadNewCallback(void *callbackData, const String *section, const String *key, const String *value)
 {
     if (callbackData != NULL)
-        strCatFmt((String *)callbackData, "[%s] %s=%s\n", strZ(section), strZ(key), strZ(jsonFromVar(value)));
+        strCatFmt((String *)callbackData, "[%s] %s=%s\n", strZ(section), strZ(key), strZ(jsonFromVar(jsonToVar(value))));
 }
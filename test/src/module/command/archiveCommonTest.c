@@ -3,6 +3,9 @@ Test Archive Common
 ***********************************************************************************************************************************/
 #include <unistd.h>
 
+#include "common/io/bufferRead.h"
+#include "common/io/io.h"
+#include "postgres/interface.h"
 #include "storage/helper.h"
 #include "storage/posix/storage.h"
 
@@ -183,6 +186,22 @@ testRun(void)
         TEST_RESULT_BOOL(walIsSegment(strNew("0000001A.history")), false, "history file");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("walIsTrimmed()"))
+    {
+        TEST_RESULT_BOOL(
+            walIsTrimmed(STRDEF("000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa")), false, "not trimmed");
+        TEST_RESULT_BOOL(
+            walIsTrimmed(STRDEF("000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.gz")), false,
+            "compressed not trimmed");
+        TEST_RESULT_BOOL(
+            walIsTrimmed(STRDEF("000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.trim")), true, "trimmed");
+        TEST_RESULT_BOOL(
+            walIsTrimmed(
+                STRDEF("9.6-1/0000000100000001/000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.trim.zst")),
+            true, "compressed trimmed with path");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("walPath()"))
     {
@@ -271,7 +290,9 @@ testRun(void)
         storagePutP(
             storageNewWriteP(
                 storageTest,
-                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz")),
+                strNew(
+                    "archive/db/9.6-2/1234567812345678/123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"
+                    ".trim.gz")),
             NULL);
 
         TEST_ERROR(
@@ -279,7 +300,7 @@ testRun(void)
             ArchiveDuplicateError,
             "duplicates found in archive for WAL segment 123456781234567812345678:"
                 " 123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
-                ", 123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz"
+                ", 123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.trim.gz"
                 "\nHINT: are multiple primaries archiving to this stanza?");
 
         TEST_RESULT_STR(
@@ -353,5 +374,89 @@ testRun(void)
         TEST_RESULT_STRLST_Z(strLstSort(list, sortOrderDesc), "11-10\n10-4\n9.4-2\n9.6-1\n", "sort descending");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("walTailSizeNew() and walTailPadNew()"))
+    {
+        // Create a 1MB WAL segment with data in the first 100KB and a zero tail
+        Buffer *wal = bufNew(1024 * 1024);
+        bufUsedSet(wal, bufSize(wal));
+        memset(bufPtr(wal), 0, bufSize(wal));
+        memset(bufPtr(wal), 0xFF, 100 * 1024);
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .size = 1024 * 1024, .systemId = 0xAAAABBBBCCCCDDDD}, wal);
+
+        // Use a small buffer size so data does not fit in a single buffer
+        ioBufferSizeSet(16 * 1024);
+
+        IoFilter *filter = NULL;
+        IoRead *read = NULL;
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("size without the zero tail");
+
+        TEST_ASSIGN(filter, walTailSizeNew(), "create size filter");
+        TEST_RESULT_VOID(ioFilterProcessIn(filter, BUFSTRDEF("\0\0")), "add zeros");
+        TEST_RESULT_UINT(varUInt64(ioFilterResult(filter)), 0, "check size with only zeros");
+        TEST_RESULT_VOID(ioFilterProcessIn(filter, BUFSTRDEF("1\0")), "add data and zero");
+        TEST_RESULT_VOID(ioFilterProcessIn(filter, BUFSTRDEF("\0\0")), "add zeros");
+        TEST_RESULT_UINT(varUInt64(ioFilterResult(filter)), 3, "check size");
+        TEST_RESULT_VOID(ioFilterFree(filter), "free filter");
+
+        read = ioBufferReadNew(wal);
+        ioFilterGroupAdd(ioReadFilterGroup(read), walTailSizeNew());
+        TEST_RESULT_VOID(ioReadDrain(read), "drain WAL");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioReadFilterGroup(read), WAL_TAIL_SIZE_FILTER_TYPE_STR)), 100 * 1024, "check WAL size");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("pad trimmed WAL");
+
+        read = ioBufferReadNew(BUF(bufPtr(wal), 100 * 1024));
+        ioFilterGroupAdd(ioReadFilterGroup(read), walTailPadNew());
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(read), wal), true, "check padded WAL");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("full WAL is not padded");
+
+        read = ioBufferReadNew(wal);
+        ioFilterGroupAdd(ioReadFilterGroup(read), walTailPadNew());
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(read), wal), true, "check WAL");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("input shorter than the WAL header errors");
+
+        read = ioBufferReadNew(BUFSTRDEF("SHORT"));
+        ioFilterGroupAdd(ioReadFilterGroup(read), walTailPadNew());
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), FormatError, "WAL segment size 5 is shorter than the WAL header size 512");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("input without a valid WAL header errors");
+
+        Buffer *junk = bufNew(1024);
+        bufUsedSet(junk, bufSize(junk));
+
+        memset(bufPtr(junk), 0, bufSize(junk));
+        read = ioBufferReadNew(junk);
+        ioFilterGroupAdd(ioReadFilterGroup(read), walTailPadNew());
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), FormatError, "first page header in WAL file is expected to be in long format");
+
+        memset(bufPtr(junk), 0xFF, bufSize(junk));
+        read = ioBufferReadNew(junk);
+        ioFilterGroupAdd(ioReadFilterGroup(read), walTailPadNew());
+        ioReadOpen(read);
+
+        TEST_ERROR(
+            ioReadBuf(read), VersionNotSupportedError,
+            "unexpected WAL magic 65535\n"
+            "HINT: is this version of PostgreSQL supported?");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -775,11 +775,34 @@ testRun(void)
         TEST_STORAGE_LIST_EMPTY(storageTest, TEST_PATH_PG "/pg_wal");
 
         // -------------------------------------------------------------------------------------------------------------------------
-        TEST_TITLE("get WAL segment");
+        TEST_TITLE("get trimmed WAL segment");
 
         Buffer *buffer = bufNew(16 * 1024 * 1024);
         memset(bufPtr(buffer), 0, bufSize(buffer));
         bufUsedSet(buffer, bufSize(buffer));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_10, .size = 16 * 1024 * 1024, .systemId = 0xFACEFACEFACEFACE}, buffer);
+
+        HRN_STORAGE_PUT(
+            storageRepoWrite(),
+            STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa" WAL_SEGMENT_TRIM_EXT,
+            BUF(bufPtr(buffer), PG_WAL_HEADER_SIZE));
+
+        TEST_RESULT_INT(cmdArchiveGet(), 0, "get");
+
+        harnessLogResult("P00   INFO: found 01ABCDEF01ABCDEF01ABCDEF in the repo1: 10-1 archive");
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageTest, STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG"))), buffer), true,
+            "check padded WAL segment");
+        TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
+        TEST_STORAGE_REMOVE(
+            storageRepoWrite(),
+            STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa" WAL_SEGMENT_TRIM_EXT);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("get WAL segment");
+
+        memset(bufPtr(buffer), 0, bufSize(buffer));
 
         HRN_STORAGE_PUT(
             storageRepoWrite(), STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
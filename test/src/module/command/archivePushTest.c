@@ -441,6 +441,7 @@ testRun(void)
         varLstAdd(paramList, varNewStrZ("000000010000000100000002"));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewInt(6));
+        varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewStrZ("11-1"));
         varLstAdd(paramList, varNewUInt64(cipherTypeNone));
         varLstAdd(paramList, NULL);
@@ -945,5 +946,236 @@ testRun(void)
             "000000010000000100000001.ok\n000000010000000100000002.ok\n", "check status files");
         }
 
+    // *****************************************************************************************************************************
+    if (testBegin("Synchronous cmdArchivePush() with push ahead"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test");
+        hrnCfgArgRawZ(argList, cfgOptCompressType, "none");
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--repo2-path=%s/repo2", testPath()));
+        strLstAddZ(argList, "--" CFGOPT_ARCHIVE_PUSH_AHEAD);
+
+        StringList *argListAhead = strLstDup(argList);
+        hrnCfgArgRawZ(argListAhead, cfgOptProcessMax, "2");
+
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("pg/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL)),
+            pgControlTestToBuffer((PgControl){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}));
+
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("repo/archive/test/archive.info")),
+            harnessInfoChecksumZ(
+                "[db]\n"
+                "db-id=1\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-id\":12297848147757817309,\"db-version\":\"9.4\"}\n"));
+
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("repo2/archive/test/archive.info")),
+            harnessInfoChecksumZ(
+                "[db]\n"
+                "db-id=1\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-id\":12297848147757817309,\"db-version\":\"9.4\"}\n"));
+
+        // Create WAL 1 and 2 along with a history file that will not be pushed ahead
+        Buffer *walBuffer1 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer1, bufSize(walBuffer1));
+        memset(bufPtr(walBuffer1), 0xFF, bufSize(walBuffer1));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer1);
+        const char *walBuffer1Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer1)));
+
+        Buffer *walBuffer2 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer2, bufSize(walBuffer2));
+        memset(bufPtr(walBuffer2), 0x0C, bufSize(walBuffer2));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer2);
+        const char *walBuffer2Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer2)));
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000001")), walBuffer1);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000002")), walBuffer2);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000001.ready")), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000002.ready")), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/archive_status/00000002.history.ready")), NULL);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL 1 and push WAL 2 ahead");
+
+        StringList *argListTemp = strLstDup(argListAhead);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000001", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        // WAL pushed ahead is logged at detail level so the order in which the jobs complete does not affect the info log
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000001' to the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s", walBuffer1Sha1)),
+            true, "check repo for WAL 1 file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)),
+            true, "check repo for WAL 2 file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo2/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)),
+            true, "check repo2 for WAL 2 file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("WAL 2 was already pushed ahead to repo1 only");
+
+        storageRemoveP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000001.ready"), .errorOnMissing = true);
+        storageRemoveP(
+            storageTest, strNewFmt("repo2/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1),
+            .errorOnMissing = true);
+
+        argListTemp = strLstDup(argListAhead);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000002", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        harnessLogLevelSet(logLevelDetail);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult(
+            "P00 DETAIL: WAL file '000000010000000100000002' was already pushed ahead to the repo1 archive\n"
+            "P00   INFO: pushed WAL file '000000010000000100000002' to the archive");
+
+        harnessLogLevelReset();
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo2/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)),
+            true, "check repo2 for WAL 2 file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error on requested WAL and WAL pushed ahead");
+
+        storageRemoveP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000002.ready"), .errorOnMissing = true);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000003.ready")), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000004.ready")), NULL);
+
+        argListTemp = strLstDup(argListAhead);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000003", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        TEST_ERROR_FMT(
+            cmdArchivePush(), FileMissingError, "raised from local-1 protocol: " STORAGE_ERROR_READ_MISSING,
+            strZ(strNewFmt("%s/pg/pg_xlog/000000010000000100000003", testPath())));
+        harnessLogResult(
+            strZ(
+                strNewFmt(
+                    "P02   WARN: could not push WAL file '000000010000000100000004' to the archive ahead (will be retried): "
+                        "[55] raised from local-2 protocol: " STORAGE_ERROR_READ_MISSING,
+                    strZ(strNewFmt("%s/pg/pg_xlog/000000010000000100000004", testPath())))));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push ahead waits until process-max WAL segments are ready");
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000003")), walBuffer1);
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgRawZ(argListTemp, cfgOptProcessMax, "3");
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000003", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push ahead is not used with a single process");
+
+        storageRemoveP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000003.ready"), .errorOnMissing = true);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000004")), walBuffer2);
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/archive_status/000000010000000100000005.ready")), NULL);
+
+        argListTemp = strLstDup(argList);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000004", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000004' to the archive");
+
+        TEST_RESULT_STRLST_Z(
+            strLstSort(storageListP(storageTest, strNew("repo/archive/test/9.4-1/0000000100000001")), sortOrderAsc),
+            strZ(
+                strNewFmt(
+                    "000000010000000100000001-%s\n000000010000000100000002-%s\n000000010000000100000003-%s\n"
+                    "000000010000000100000004-%s\n",
+                    walBuffer1Sha1, walBuffer2Sha1, walBuffer1Sha1, walBuffer2Sha1)),
+            "WAL 5 was not pushed ahead");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL without the zero tail");
+
+        Buffer *walBuffer5 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer5, bufSize(walBuffer5));
+        memset(bufPtr(walBuffer5), 0, bufSize(walBuffer5));
+        memset(bufPtr(walBuffer5), 0x33, 64 * 1024);
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer5);
+        const char *walBuffer5Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer5)));
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000005")), walBuffer5);
+
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_PUSH_TRIM);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000005", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000005' to the archive");
+
+        TEST_RESULT_UINT(
+            storageInfoP(
+                storageTest,
+                strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000005-%s.trim", walBuffer5Sha1)).size,
+            64 * 1024, "check trimmed size in repo");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL without the zero tail keeps the header");
+
+        memset(bufPtr(walBuffer5), 0, bufSize(walBuffer5));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer5);
+        const char *walBuffer6Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer5)));
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000006")), walBuffer5);
+
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_PUSH_TRIM);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000006", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000006' to the archive");
+
+        TEST_RESULT_UINT(
+            storageInfoP(
+                storageTest,
+                strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000006-%s.trim", walBuffer6Sha1)).size,
+            PG_WAL_HEADER_SIZE, "check trimmed size in repo");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL without a zero tail is not marked trimmed");
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_xlog/000000010000000100000007")), walBuffer1);
+
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "--" CFGOPT_ARCHIVE_PUSH_TRIM);
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog/000000010000000100000007", testPath()));
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000007' to the archive");
+
+        TEST_RESULT_UINT(
+            storageInfoP(
+                storageTest,
+                strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000007-%s", walBuffer1Sha1)).size,
+            16 * 1024 * 1024, "check full size in repo");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -239,6 +239,7 @@ typedef struct TestBackupPqScriptParam
     bool errorAfterStart;
     bool noWal;                                                     // Don't write test WAL segments
     CompressType walCompressType;                                   // Compress type for the archive files
+    bool walTrim;                                                   // Store the first WAL segment without its zero tail
     unsigned int walTotal;                                          // Total WAL to write
     unsigned int timeline;                                          // Timeline to use for WAL files
 } TestBackupPqScriptParam;
@@ -282,21 +283,30 @@ testBackupPqScript(unsigned int pgVersion, time_t backupTimeStart, TestBackupPqS
         Buffer *walBuffer = bufNew((size_t)pgControl.walSegmentSize);
         bufUsedSet(walBuffer, bufSize(walBuffer));
         memset(bufPtr(walBuffer), 0, bufSize(walBuffer));
-        pgWalTestToBuffer((PgWal){.version = pgControl.version, .systemId = pgControl.systemId}, walBuffer);
+        pgWalTestToBuffer(
+            (PgWal){.version = pgControl.version, .systemId = pgControl.systemId, .size = pgControl.walSegmentSize}, walBuffer);
         const String *walChecksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer));
 
+        // Find the size of the segment without the zero tail but with the header, as archive-push-trim would store it
+        size_t walTrimSize = bufUsed(walBuffer);
+
+        while (walTrimSize > PG_WAL_HEADER_SIZE && bufPtr(walBuffer)[walTrimSize - 1] == 0)
+            walTrimSize--;
+
         for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
         {
+            const bool walTrim = param.walTrim && walSegmentIdx == 0;
+
             StorageWrite *write = storageNewWriteP(
                 storageRepoWrite(),
                 strNewFmt(
-                    STORAGE_REPO_ARCHIVE "/%s/%s-%s%s", strZ(archiveId), strZ(strLstGet(walSegmentList, walSegmentIdx)),
-                    strZ(walChecksum), strZ(compressExtStr(param.walCompressType))));
+                    STORAGE_REPO_ARCHIVE "/%s/%s-%s%s%s", strZ(archiveId), strZ(strLstGet(walSegmentList, walSegmentIdx)),
+                    strZ(walChecksum), walTrim ? WAL_SEGMENT_TRIM_EXT : "", strZ(compressExtStr(param.walCompressType))));
 
             if (param.walCompressType != compressTypeNone)
                 ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(param.walCompressType, 1));
 
-            storagePutP(write, walBuffer);
+            storagePutP(write, walTrim ? BUF(bufPtr(walBuffer), walTrimSize) : walBuffer);
         }
     }
 
@@ -489,8 +499,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                missingFile, true, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                missingFile, true, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, false, 0, backupLabel, false,
+                false, cipherTypeNone, NULL),
             "pg file missing, ignoreMissing=true, no delta");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy/repo size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -509,21 +519,25 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(0));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAdaptive
+        varLstAdd(paramList, varNewUInt(0));                // repoFileChecksumBlockSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // resume
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - skip");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":[3,0,0,null,null]}\n", "    check result");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":[3,0,0,null,null,0,false,0,null]}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
         // Pg file missing - ignoreMissing=false
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ERROR_FMT(
             backupFile(
-                missingFile, false, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                missingFile, false, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, false, 0, backupLabel, false,
+                false, cipherTypeNone, NULL),
             FileMissingError, "unable to open missing file '%s/pg/missing' for read", testPath());
 
         // Create a pg file to backup
@@ -544,8 +558,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9999999, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                pgFile, false, 9999999, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, false, 0, backupLabel, false,
+                false, cipherTypeNone, NULL),
             "pg file exists and shrunk, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         ((Storage *)storageRepo())->interface.feature = feature;
@@ -572,8 +586,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                pgFile, false, 9, true, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, false, 0, backupLabel,
+                false, false, cipherTypeNone, NULL),
             "file checksummed with pageChecksum enabled");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -588,7 +602,7 @@ testRun(void)
 
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
-        // pgFileSize, ignoreMissing=false, backupLabel, pgFileChecksumPage, pgFileChecksumPageLsnLimit
+        // pgFileSize, ignoreMissing=false, 0, backupLabel, pgFileChecksumPage, pgFileChecksumPageLsnLimit
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(pgFile));            // pgFile
         varLstAdd(paramList, varNewBool(false));            // pgFileIgnoreMissing
@@ -601,15 +615,20 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(1));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAdaptive
+        varLstAdd(paramList, varNewUInt(0));                // repoFileChecksumBlockSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // resume
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - pageChecksum");
         TEST_RESULT_STR_Z(
             strNewBuf(serverWrite),
-            "{\"out\":[1,12,12,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",{\"align\":false,\"valid\":false}]}\n",
+            "{\"out\":[1,12,12,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",{\"align\":false,\"valid\":false},0,false,0"
+                ",null]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
 
@@ -619,7 +638,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeNone, NULL),
             "file in db and repo, checksum equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 0, "    repo size not set since already exists in repo");
@@ -644,14 +663,19 @@ testRun(void)
         varLstAdd(paramList, varNewBool(true));             // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(1));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAdaptive
+        varLstAdd(paramList, varNewUInt(0));                // repoFileChecksumBlockSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(true));             // delta
+        varLstAdd(paramList, varNewBool(false));             // resume
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - noop");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[4,12,0,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",null]}\n", "    check result");
+            strNewBuf(serverWrite), "{\"out\":[4,12,0,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",null,0,false,0,null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -660,7 +684,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeNone, NULL),
             "file in db and repo, pg checksum not equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -675,7 +699,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9999999, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeNone, NULL),
             "db & repo file, pg checksum same, pg size different, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 24, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -692,7 +716,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, STRDEF(BOGUS_STR), false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeNone, NULL),
             "backup file");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    check copy result");
@@ -710,7 +734,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeNone, NULL),
             "    db & repo file, pgFileMatch, repo checksum no match, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    recopy file");
@@ -728,7 +752,7 @@ testRun(void)
             result,
             backupFile(
                 missingFile, true, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeNone, NULL),
             "    file in repo only, checksum in repo equal, ignoreMissing=true, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=0 size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -741,7 +765,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabel, false, cipherTypeNone, NULL),
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, false, 0, backupLabel, false,
+                false, cipherTypeNone, NULL),
             "pg file exists, no checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -759,7 +784,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, compressTypeGz,
-                3, backupLabel, false, cipherTypeNone, NULL),
+                3, false, 0, backupLabel, false, false, cipherTypeNone, NULL),
             "pg file & repo exists, match, checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -786,16 +811,84 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeGz));   // repoFileCompress
         varLstAdd(paramList, varNewInt(3));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAdaptive
+        varLstAdd(paramList, varNewUInt(0));                // repoFileChecksumBlockSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // resume
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - copy, compress");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n", "    check result");
+            strNewBuf(serverWrite), "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,0,false,0,null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("adaptive compress level is returned");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, true, 0, backupLabel, false,
+                false, cipherTypeNone, NULL),
+            "copy with adaptive compress level");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_UINT(result.repoSize, 29, "    repo compress size");
+        TEST_RESULT_UINT(result.compressLevel, 3, "    compress level");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block checksums are stored");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, false, 4, backupLabel, false,
+                false, cipherTypeNone, NULL),
+            "copy with block checksums");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_UINT(result.checksumBlockSize, 4, "    checksum block size");
+        TEST_RESULT_STR_Z(result.checksumBlockSha1, "94fe9027726e191ab5b7a4941081fde788873284", "    checksum block sha1");
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(
+                    storageNewReadP(
+                        storageRepo(),
+                        strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(backupLabel), strZ(pgFile))))),
+            "716845cc31b39d291855cdce64e5450b258da84d3bc871674af87645b1c6ad82c664004a650c20c0"
+            "58e6b3a414a1e090dfc6029add0f3555ccba127f",
+            "    check block checksums");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("incompressible file is stored without compression");
+
+        Buffer *random = bufNew(1024 * 1024);
+        uint32_t seed = 1;
+
+        for (size_t randomIdx = 0; randomIdx < bufSize(random); randomIdx++)
+        {
+            seed = seed * 1103515245 + 12345;
+            bufPtr(random)[randomIdx] = (unsigned char)(seed >> 16);
+        }
+
+        bufUsedSet(random, bufSize(random));
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("random")), random);
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                STRDEF("random"), false, bufUsed(random), true, NULL, false, 0, STRDEF("random"), false, compressTypeGz, 3,
+                false, 0, backupLabel, false, false, cipherTypeNone, NULL),
+            "copy incompressible file");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_BOOL(result.compressSkip, true, "    compress skipped");
+        TEST_RESULT_UINT(result.repoSize, bufUsed(random), "    repo size equals file size");
+        TEST_RESULT_BOOL(
+            storageExistsP(storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/random", strZ(backupLabel))), true,
+            "    repo file has no compression extension");
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Create a zero sized file - checksum will be set but in backupManifestUpdate it will not be copied
         storagePutP(storageNewWriteP(storagePgWrite(), strNew("zerofile")), BUFSTRDEF(""));
@@ -804,8 +897,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                strNew("zerofile"), false, 0, true, NULL, false, 0, strNew("zerofile"), false, compressTypeNone, 1, backupLabel,
-                false, cipherTypeNone, NULL),
+                strNew("zerofile"), false, 0, true, NULL, false, 0, strNew("zerofile"), false, compressTypeNone, 1, false, 0,
+                backupLabel, false, false, cipherTypeNone, NULL),
             "zero-sized pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=pgFile size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -845,8 +938,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false, cipherTypeAes256Cbc,
-                strNew("12345678")),
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, false, 0, backupLabel, false, false,
+                cipherTypeAes256Cbc, strNew("12345678")),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -857,13 +950,37 @@ testRun(void)
             storageExistsP(storageRepo(), backupPathFile) && result.pageChecksumResult == NULL),
             true, "    copy file to encrypted repo success");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block checksums are encrypted");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, false, 4, backupLabel, false, false,
+                cipherTypeAes256Cbc, strNew("12345678")),
+            "copy with block checksums");
+        TEST_RESULT_UINT(result.checksumBlockSize, 4, "    checksum block size");
+        TEST_RESULT_STR_Z(result.checksumBlockSha1, "94fe9027726e191ab5b7a4941081fde788873284", "    checksum block sha1");
+
+        StorageRead *blockRead = storageNewReadP(
+            storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(backupLabel), strZ(pgFile)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(blockRead)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("12345678"), NULL));
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(blockRead)),
+            "716845cc31b39d291855cdce64e5450b258da84d3bc871674af87645b1c6ad82c664004a650c20c0"
+            "58e6b3a414a1e090dfc6029add0f3555ccba127f",
+            "    check block checksums");
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Delta but pgMatch false (pg File size different), prior checksum, no compression, no pageChecksum, delta, no hasReference
         TEST_ASSIGN(
             result,
             backupFile(
                 pgFile, false, 8, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeAes256Cbc, strNew("12345678")),
+                compressTypeNone, 1, false, 0, backupLabel, true, false, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, pgFileMatch false, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 8, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -880,7 +997,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, false,
-                compressTypeNone, 0, backupLabel, false, cipherTypeAes256Cbc, strNew("12345678")),
+                compressTypeNone, 0, false, 0, backupLabel, false, false, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, repo checksum no match, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -905,14 +1022,19 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));                // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone));     // repoFileCompress
         varLstAdd(paramList, varNewInt(0));                     // repoFileCompressLevel
+        varLstAdd(paramList, varNewBool(false));                // repoFileCompressLevelAdaptive
+        varLstAdd(paramList, varNewUInt(0));                    // repoFileChecksumBlockSize
         varLstAdd(paramList, varNewStr(backupLabel));           // backupLabel
         varLstAdd(paramList, varNewBool(false));                // delta
+        varLstAdd(paramList, varNewBool(false));                // resume
+        varLstAdd(paramList, varNewUInt(cipherTypeAes256Cbc));  // cipherType
         varLstAdd(paramList, varNewStrZ("12345678"));           // cipherPass
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - recopy, encrypt");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n", "    check result");
+            strNewBuf(serverWrite), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,0,false,0,null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
     }
 
@@ -1390,6 +1512,89 @@ testRun(void)
             storagePathExistsP(storageRepo(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F")), false, "check backup path removed");
 
         manifestResume->data.backupOptionCompressType = compressTypeNone;
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("resume with file results from journal");
+
+        manifestSave(
+            manifestResume,
+            storageWriteIo(
+                storageNewWriteP(
+                    storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" BACKUP_MANIFEST_FILE INFO_COPY_EXT))));
+
+        Manifest *manifestJournal = manifestNewInternal();
+        manifestJournal->data.backupLabel = STRDEF("20191003-105320F");
+
+        manifestFileAdd(
+            manifestJournal,
+            &(ManifestFile){
+                .name = STRDEF("pg_data/" PG_FILE_PGVERSION), .size = 4, .sizeRepo = 4,
+                .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
+        manifestFileAdd(
+            manifestJournal,
+            &(ManifestFile){
+                .name = STRDEF("pg_data/base/1/1"), .size = 16384, .sizeRepo = 8192, .compressLevel = 7,
+                .checksumSha1 = "bbbbbbbbbbccccccccccddddddddddeeeeeeeeee", .checksumPage = true, .checksumPageError = true,
+                .checksumPageErrorList = jsonToVarLst(STRDEF("[0,[2,3]]"))});
+        manifestFileAdd(manifestJournal, &(ManifestFile){.name = STRDEF("pg_data/removed"), .size = 1, .sizeRepo = 1});
+        lstSort(manifestJournal->fileList, sortOrderAsc);
+
+        manifestFileAdd(manifestResume, &(ManifestFile){.name = STRDEF("pg_data/base/1/1")});
+        lstSort(manifestResume->fileList, sortOrderAsc);
+
+        manifestSave(
+            manifestResume,
+            storageWriteIo(
+                storageNewWriteP(
+                    storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" BACKUP_MANIFEST_FILE INFO_COPY_EXT))));
+
+        List *fileJournal = lstNewP(sizeof(String *));
+        lstAdd(fileJournal, &manifestFile(manifestJournal, 0)->name);
+        lstAdd(fileJournal, &manifestFile(manifestJournal, 1)->name);
+
+        TEST_RESULT_VOID(backupManifestJournalSave(manifestJournal, fileJournal, 1, NULL), "save journal segment 1");
+
+        // A later segment overrides an earlier one
+        manifestFileUpdate(
+            manifestJournal, STRDEF("pg_data/" PG_FILE_PGVERSION), 4, 3, 0, true, "ccccccccccaaaaaaaaaabbbbbbbbbbdddddddddd",
+            0, NULL, NULL, false, false, NULL);
+
+        lstClear(fileJournal);
+        lstAdd(fileJournal, &manifestFile(manifestJournal, 2)->name);
+        lstAdd(fileJournal, &manifestFile(manifestJournal, 0)->name);
+
+        TEST_RESULT_VOID(backupManifestJournalSave(manifestJournal, fileJournal, 2, NULL), "save journal segment 2");
+
+        TEST_ASSIGN(manifestResume, (Manifest *)backupResumeFind(manifest, NULL), "find resumable backup");
+
+        TEST_RESULT_UINT(manifestFileTotal(manifestResume), 2, "check file total");
+
+        const ManifestFile *file = manifestFileFind(manifestResume, STRDEF("pg_data/" PG_FILE_PGVERSION));
+        TEST_RESULT_Z(file->checksumSha1, "ccccccccccaaaaaaaaaabbbbbbbbbbdddddddddd", "check checksum");
+        TEST_RESULT_UINT(file->size, 4, "check size");
+        TEST_RESULT_UINT(file->sizeRepo, 3, "check repo size");
+        TEST_RESULT_BOOL(file->compressSkip, true, "check compress skip");
+        TEST_RESULT_BOOL(file->checksumPage, false, "check checksum page");
+
+        file = manifestFileFind(manifestResume, STRDEF("pg_data/base/1/1"));
+        TEST_RESULT_Z(file->checksumSha1, "bbbbbbbbbbccccccccccddddddddddeeeeeeeeee", "check checksum");
+        TEST_RESULT_UINT(file->size, 16384, "check size");
+        TEST_RESULT_UINT(file->sizeRepo, 8192, "check repo size");
+        TEST_RESULT_UINT(file->compressLevel, 7, "check compress level");
+        TEST_RESULT_BOOL(file->checksumPage, true, "check checksum page");
+        TEST_RESULT_BOOL(file->checksumPageError, true, "check checksum page error");
+        TEST_RESULT_STR_Z(jsonFromVar(varNewVarLst(file->checksumPageErrorList)), "[0,[2,3]]", "check checksum page error list");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("full manifest save removes journal");
+
+        TEST_RESULT_VOID(backupManifestSaveCopy(manifestResume, NULL), "save manifest copy");
+
+        TEST_RESULT_STRLST_Z(
+            strLstSort(storageListP(storageRepo(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F")), sortOrderAsc),
+            BACKUP_MANIFEST_FILE INFO_COPY_EXT "\n", "check journal removed");
+
+        storagePathRemoveP(storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F"), .recurse = true);
     }
 
     // *****************************************************************************************************************************
@@ -1404,7 +1609,9 @@ testRun(void)
         ProtocolParallelJob *job = protocolParallelJobNew(VARSTRDEF("key"), protocolCommandNew(STRDEF("command")));
         protocolParallelJobErrorSet(job, errorTypeCode(&AssertError), STRDEF("error message"));
 
-        TEST_ERROR(backupJobResult((Manifest *)1, NULL, STRDEF("log"), strLstNew(), job, 0, 0), AssertError, "error message");
+        TEST_ERROR(
+            backupJobResult((Manifest *)1, NULL, STRDEF("log"), strLstNew(), lstNewP(sizeof(String *)), job, 0, 0), AssertError,
+            "error message");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("report host/100% progress on noop result");
@@ -1418,6 +1625,10 @@ testRun(void)
         varLstAdd(result, varNewUInt64(0));
         varLstAdd(result, NULL);
         varLstAdd(result, NULL);
+        varLstAdd(result, varNewUInt(0));
+        varLstAdd(result, varNewBool(false));
+        varLstAdd(result, varNewUInt(0));
+        varLstAdd(result, NULL);
 
         protocolParallelJobResultSet(job, varNewVarLst(result));
 
@@ -1426,9 +1637,83 @@ testRun(void)
         manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF("pg_data/test")});
 
         TEST_RESULT_UINT(
-            backupJobResult(manifest, STRDEF("host"), STRDEF("log-test"), strLstNew(), job, 0, 0), 0, "log noop result");
+            backupJobResult(manifest, STRDEF("host"), STRDEF("log-test"), strLstNew(), lstNewP(sizeof(String *)), job, 0, 0), 0,
+            "log noop result");
 
         TEST_RESULT_LOG("P00 DETAIL: match file from prior backup host:log-test (0B, 100%)");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("delta copy of a file that skipped compression in the prior backup keeps compress skip");
+
+        harnessLogLevelReset();
+
+        // The file was sent to the job without compression so the job did not report compress skip
+        job = protocolParallelJobNew(VARSTRDEF("pg_data/test-skip"), protocolCommandNew(STRDEF("command")));
+
+        result = varLstNew();
+        varLstAdd(result, varNewUInt64(backupCopyResultCopy));
+        varLstAdd(result, varNewUInt64(4));
+        varLstAdd(result, varNewUInt64(4));
+        varLstAdd(result, varNewStrZ("ccccccccccaaaaaaaaaabbbbbbbbbbdddddddddd"));
+        varLstAdd(result, NULL);
+        varLstAdd(result, varNewUInt(0));
+        varLstAdd(result, varNewBool(false));
+        varLstAdd(result, varNewUInt(0));
+        varLstAdd(result, NULL);
+
+        protocolParallelJobResultSet(job, varNewVarLst(result));
+
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){
+                .name = STRDEF("pg_data/test-skip"), .size = 4, .compressSkip = true, .reference = STRDEF("20191003-105320F"),
+                .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
+
+        TEST_RESULT_UINT(
+            backupJobResult(manifest, NULL, STRDEF("skip"), strLstNew(), lstNewP(sizeof(String *)), job, 4, 0), 4,
+            "delta copy result");
+        TEST_RESULT_BOOL(manifestFileFind(manifest, STRDEF("pg_data/test-skip"))->compressSkip, true, "    compress skip kept");
+        TEST_RESULT_PTR(manifestFileFind(manifest, STRDEF("pg_data/test-skip"))->reference, NULL, "    reference removed");
+
+        TEST_RESULT_LOG(
+            "P00   INFO: backup file skip (4B, 100%) checksum ccccccccccaaaaaaaaaabbbbbbbbbbdddddddddd");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("recopy of a resumed file that skipped compression keeps compress skip");
+
+        job = protocolParallelJobNew(VARSTRDEF("pg_data/test-skip-resume"), protocolCommandNew(STRDEF("command")));
+
+        result = varLstNew();
+        varLstAdd(result, varNewUInt64(backupCopyResultReCopy));
+        varLstAdd(result, varNewUInt64(4));
+        varLstAdd(result, varNewUInt64(4));
+        varLstAdd(result, varNewStrZ("ccccccccccaaaaaaaaaabbbbbbbbbbdddddddddd"));
+        varLstAdd(result, NULL);
+        varLstAdd(result, varNewUInt(0));
+        varLstAdd(result, varNewBool(false));
+        varLstAdd(result, varNewUInt(0));
+        varLstAdd(result, NULL);
+
+        protocolParallelJobResultSet(job, varNewVarLst(result));
+
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){
+                .name = STRDEF("pg_data/test-skip-resume"), .size = 4, .compressSkip = true,
+                .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
+
+        TEST_RESULT_UINT(
+            backupJobResult(manifest, NULL, STRDEF("skip-resume"), strLstNew(), lstNewP(sizeof(String *)), job, 4, 0), 4,
+            "resume recopy result");
+        TEST_RESULT_BOOL(
+            manifestFileFind(manifest, STRDEF("pg_data/test-skip-resume"))->compressSkip, true, "    compress skip kept");
+
+        TEST_RESULT_LOG(
+            "P00   WARN: resumed backup file pg_data/test-skip-resume does not have expected checksum"
+                " aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd. The file will be recopied and backup will continue but this may be an"
+                " issue unless the resumed backup path in the repository is known to be corrupted.\n"
+                "            NOTE: this does not indicate a problem with the PostgreSQL page checksums.\n"
+            "P00   INFO: backup file skip-resume (4B, 100%) checksum ccccccccccaaaaaaaaaabbbbbbbbbbdddddddddd");
     }
 
     // Offline tests should only be used to test offline functionality and errors easily tested in offline mode
@@ -1840,6 +2125,13 @@ testRun(void)
                     storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/pg_data/not-in-resume.gz", strZ(resumeLabel))),
                 NULL);
 
+            // Block checksums exist for a file that will not be resumed
+            storagePutP(
+                storageNewWriteP(
+                    storageRepoWrite(),
+                    strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/pg_data/not-in-resume", strZ(resumeLabel))),
+                BUFSTRDEF("BLOCK"));
+
             // Remove checksum from file so it won't be resumed
             storagePutP(
                 storageNewWriteP(
@@ -1935,6 +2227,8 @@ testRun(void)
                     " (mismatched timestamp)\n"
                 "P00 DETAIL: remove file '{[path]}/repo/backup/test1/20191003-105320F/pg_data/zero-size.gz' from resumed backup"
                     " (zero size)\n"
+                "P00 DETAIL: remove block checksums '{[path]}/repo/backup/test1/20191003-105320F/block/pg_data/not-in-resume'"
+                    " from resumed backup\n"
                 "P01   INFO: backup file {[path]}/pg1/global/pg_control (8KB, [PCT]) checksum [SHA1]\n"
                 "P01   INFO: backup file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
                 "P01   INFO: backup file {[path]}/pg1/time-mismatch (4B, [PCT]) checksum [SHA1]\n"
@@ -1948,6 +2242,15 @@ testRun(void)
                 "P00   INFO: check archive for segment(s) 0000000105D95D3000000000:0000000105D95D3000000000\n"
                 "P00   INFO: new backup label = 20191003-105320F");
 
+            TEST_RESULT_BOOL(
+                storageExistsP(
+                    storageRepo(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" MANIFEST_PATH_BLOCK "/pg_data/not-in-resume")),
+                false, "block checksums removed");
+            TEST_RESULT_VOID(
+                storagePathRemoveP(
+                    storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" MANIFEST_PATH_BLOCK), .recurse = true),
+                "remove block checksum path");
+
             TEST_RESULT_STR_Z_KEYRPL(
                 testBackupValidate(storageRepo(), STRDEF(STORAGE_REPO_BACKUP "/latest")),
                 ". {link, d=20191003-105320F}\n"
@@ -2406,7 +2709,8 @@ testRun(void)
             ((Storage *)storageRepoWrite())->interface.feature ^= 1 << storageFeatureHardLink;
 
             // Run backup
-            testBackupPqScriptP(PG_VERSION_11, backupTimeStart, .walCompressType = compressTypeGz, .walTotal = 3);
+            // The first segment is trimmed so it is padded and compressed again while the others are copied as is
+            testBackupPqScriptP(PG_VERSION_11, backupTimeStart, .walCompressType = compressTypeGz, .walTrim = true, .walTotal = 3);
             TEST_RESULT_VOID(cmdBackup(), "backup");
 
             // Reset storage features
@@ -4,6 +4,7 @@ Test Expire Command
 #include <unistd.h>
 
 #include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
 #include "storage/posix/storage.h"
 
 #include "common/harnessConfig.h"
@@ -2431,5 +2432,99 @@ testRun(void)
         harnessLogLevelReset();
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("expireProtocol() and expireRemove()"))
+    {
+        StringList *argList = strLstDup(argListAvoidWarn);
+        harnessCfgLoad(cfgCmdExpire, argList);
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("expireProtocol()");
+
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/0000000100000000/a", strZ(archiveStanzaPath))), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/0000000100000000/b", strZ(archiveStanzaPath))), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/0000000100000000/c", strZ(archiveStanzaPath))), NULL);
+
+        // Start a protocol server to test the protocol directly
+        Buffer *serverWrite = bufNew(8192);
+        IoWrite *serverWriteIo = ioBufferWriteNew(serverWrite);
+        ioWriteOpen(serverWriteIo);
+        ProtocolServer *server = protocolServerNew(strNew("test"), strNew("test"), ioBufferReadNew(bufNew(0)), serverWriteIo);
+        bufUsedSet(serverWrite, 0);
+
+        StringList *fileList = strLstNew();
+        strLstAddZ(fileList, "a");
+        strLstAddZ(fileList, "b");
+
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt(0));
+        varLstAdd(paramList, varNewStrZ(STORAGE_REPO_ARCHIVE "/9.4-1/0000000100000000"));
+        varLstAdd(paramList, varNewVarLst(varLstNewStrLst(fileList)));
+
+        TEST_RESULT_BOOL(expireProtocol(PROTOCOL_COMMAND_EXPIRE_REMOVE_STR, paramList, server), true, "protocol remove files");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "check result");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageTest, strNewFmt("%s/9.4-1/0000000100000000", strZ(archiveStanzaPath))), "c\n", "check files");
+        bufUsedSet(serverWrite, 0);
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt(0));
+        varLstAdd(paramList, varNewStrZ(STORAGE_REPO_ARCHIVE "/9.4-1"));
+        varLstAdd(paramList, NULL);
+
+        TEST_RESULT_BOOL(expireProtocol(PROTOCOL_COMMAND_EXPIRE_REMOVE_STR, paramList, server), true, "protocol remove path");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "check result");
+        TEST_RESULT_BOOL(
+            storagePathExistsP(storageTest, strNewFmt("%s/9.4-1", strZ(archiveStanzaPath))), false, "check path removed");
+        bufUsedSet(serverWrite, 0);
+
+        TEST_RESULT_BOOL(expireProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid protocol function");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("parallel remove");
+
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/0000000100000000/a", strZ(archiveStanzaPath))), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/0000000100000000/b", strZ(archiveStanzaPath))), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/0000000200000000/a", strZ(archiveStanzaPath))), NULL);
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/10-2/0000000100000000/a", strZ(archiveStanzaPath))), NULL);
+
+        argList = strLstDup(argListAvoidWarn);
+        strLstAddZ(argList, "--process-max=2");
+        harnessCfgLoad(cfgCmdExpire, argList);
+
+        List *removeList = lstNewP(sizeof(ExpireRemove));
+        TEST_RESULT_VOID(expireRemove(removeList, 0), "nothing to remove");
+
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/0000000100000000"), STRDEF("a"));
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/0000000100000000"), STRDEF("b"));
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/0000000200000000"), NULL);
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_ARCHIVE "/10-2"), NULL);
+        TEST_RESULT_UINT(lstSize(removeList), 3, "files in the same path are batched");
+
+        TEST_RESULT_VOID(expireRemove(removeList, 0), "remove in parallel");
+        TEST_RESULT_STRLST_Z(storageListP(storageTest, archiveStanzaPath), "9.4-1\n", "check paths removed");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageTest, strNewFmt("%s/9.4-1", strZ(archiveStanzaPath))), "0000000100000000\n", "check files removed");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageTest, strNewFmt("%s/9.4-1/0000000100000000", strZ(archiveStanzaPath))), NULL,
+            "check files removed");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("parallel remove error");
+
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/9.4-1/file", strZ(archiveStanzaPath))), NULL);
+
+        removeList = lstNewP(sizeof(ExpireRemove));
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/0000000100000000"), NULL);
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_ARCHIVE "/9.4-1/file"), NULL);
+
+        TEST_ERROR_FMT(
+            expireRemove(removeList, 0), PathOpenError,
+            "raised from local-2 protocol: unable to list file info for path '%s/repo/archive/db/9.4-1/file': [20] Not a directory",
+            testPath());
+
+        protocolFree();
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
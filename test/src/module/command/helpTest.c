@@ -132,12 +132,16 @@ testRun(void)
             "                                   cluster [default=preserve]\n"
             "  --db-include                     restore only specified databases\n"
             "                                   [current=db1, db2]\n"
+            "  --decode-host                    host where restored files are decrypted and\n"
+            "                                   decompressed [default=pg]\n"
             "  --force                          force a restore [default=n]\n"
             "  --link-all                       restore all symlinks [default=n]\n"
             "  --link-map                       modify the destination of a symlink\n"
             "                                   [current=/link1=/dest1, /link2=/dest2]\n"
             "  --recovery-option                set an option in recovery.conf\n"
             "  --set                            backup set to restore [default=latest]\n"
+            "  --sync-defer                     sync restored files after all files are\n"
+            "                                   restored [default=n]\n"
             "  --tablespace-map                 restore a tablespace into the specified\n"
             "                                   directory\n"
             "  --tablespace-map-all             restore all tablespaces into the specified\n"
@@ -2606,6 +2606,54 @@ testRun(void)
         TEST_ERROR_FMT(
                 cmdInfo(), FileMissingError, "manifest does not exist for backup 'bogus'\n"
                 "HINT: is the backup listed when running the info command with --stanza option only?");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("progress of a running backup/restore");
+
+        argList = strLstNew();
+        strLstAdd(argList, strNewFmt("--repo-path=%s", strZ(repoPath)));
+        strLstAddZ(argList, "--stanza=stanza1");
+        strLstAddZ(argList, "--set=current");
+        harnessCfgLoad(cfgCmdInfo, argList);
+
+        TEST_RESULT_STR_Z(infoRender(), "stanza: stanza1\n    status: no backup or restore running\n", "nothing running");
+
+        const String *progressBackup = strNewFmt(
+            "{\"command\":\"backup\",\"eta\":3723,\"pid\":%d,\"rate\":1048576,\"size-done\":4194304,\"size-total\":8388608"
+            ",\"timestamp-start\":1600000000,\"timestamp-update\":1600000060"
+            ",\"worker\":[{\"file\":\"pg_data/base/1/1\",\"time\":75},{\"file\":null}]}",
+            getpid());
+
+        storagePutP(
+            storageNewWriteP(storageLocalWrite(), strNewFmt("%s/lock/stanza1-backup" PROGRESS_FILE_EXT, testDataPath())),
+            BUFSTR(progressBackup));
+        storagePutP(
+            storageNewWriteP(storageLocalWrite(), strNewFmt("%s/lock/stanza1-restore" PROGRESS_FILE_EXT, testDataPath())),
+            BUFSTRDEF(
+                "{\"command\":\"restore\",\"pid\":0,\"rate\":0,\"size-done\":0,\"size-total\":0"
+                ",\"timestamp-start\":1600000000,\"timestamp-update\":1600000000,\"worker\":[]}"));
+
+        TEST_RESULT_STR(
+            infoRender(),
+            strNewFmt(
+                "stanza: stanza1\n"
+                "    status: backup running (pid %d)\n"
+                "        timestamp start/update: 2020-09-13 12:26:40 / 2020-09-13 12:27:40\n"
+                "        progress: 4MB of 8MB (50.00%%)\n"
+                "        rate: 1MB/s, remaining: 1h02m03s\n"
+                "        worker 1: pg_data/base/1/1 (0h01m15s)\n"
+                "        worker 2: idle\n",
+                getpid()),
+            "backup running, restore status ignored since the process is gone");
+
+        argList = strLstNew();
+        strLstAdd(argList, strNewFmt("--repo-path=%s", strZ(repoPath)));
+        strLstAddZ(argList, "--stanza=stanza1");
+        strLstAddZ(argList, "--set=current");
+        strLstAddZ(argList, "--output=json");
+        harnessCfgLoad(cfgCmdInfo, argList);
+
+        TEST_RESULT_STR(infoRender(), strNewFmt("[%s]", strZ(progressBackup)), "json output");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -0,0 +1,139 @@
+/***********************************************************************************************************************************
+Test Progress Reporting
+***********************************************************************************************************************************/
+#include "common/harnessConfig.h"
+#include "common/harnessFork.h"
+#include "storage/posix/storage.h"
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // Create default storage object for testing
+    Storage *storageData = storagePosixNewP(strNew(testDataPath()), .write = true);
+
+    // *****************************************************************************************************************************
+    if (testBegin("progressNew(), progressWorkerSet(), progressUpdate(), progressLoad(), and progressFree()"))
+    {
+        StringList *argList = strLstNew();
+        hrnCfgArgRawZ(argList, cfgOptStanza, "db");
+        hrnCfgArgRawZ(argList, cfgOptPgPath, "/pg");
+        harnessCfgLoad(cfgCmdRestore, argList);
+
+        const String *stanza = STRDEF("db");
+        const String *progressFile = STRDEF("lock/db-restore" PROGRESS_FILE_EXT);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("no status file");
+
+        TEST_RESULT_PTR(progressLoad(stanza, STRDEF("restore")), NULL, "load missing status file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("status file written on create");
+
+        Progress *progress = NULL;
+        TEST_ASSIGN(progress, progressNew(8192, 2), "new progress");
+        TEST_RESULT_BOOL(storageExistsP(storageData, progressFile), true, "status file exists");
+
+        KeyValue *status = NULL;
+        TEST_ASSIGN(status, progressLoad(stanza, STRDEF("restore")), "load status");
+        TEST_RESULT_STR_Z(varStr(kvGet(status, PROGRESS_KEY_COMMAND_VAR)), "restore", "check command");
+        TEST_RESULT_INT(varIntForce(kvGet(status, PROGRESS_KEY_PID_VAR)), getpid(), "check pid");
+        TEST_RESULT_UINT(varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_TOTAL_VAR)), 8192, "check size total");
+        TEST_RESULT_UINT(varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_DONE_VAR)), 0, "check size done");
+        TEST_RESULT_PTR(kvGet(status, PROGRESS_KEY_ETA_VAR), NULL, "no eta yet");
+        TEST_RESULT_STR_Z(
+            jsonFromVar(kvGet(status, PROGRESS_KEY_WORKER_VAR)), "[{\"file\":null},{\"file\":null}]", "check workers");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("update is skipped until the save interval has passed");
+
+        TEST_RESULT_VOID(progressWorkerSet(progress, 0, STRDEF("pg_data/base/1/1")), "set worker 0");
+        TEST_RESULT_VOID(progressWorkerSet(progress, 1, STRDEF("pg_data/base/1/2")), "set worker 1");
+        TEST_RESULT_VOID(progressWorkerSet(progress, 1, NULL), "set worker 1 idle");
+        TEST_RESULT_VOID(progressUpdate(progress, 4096), "update");
+
+        TEST_ASSIGN(status, progressLoad(stanza, STRDEF("restore")), "load status");
+        TEST_RESULT_UINT(varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_DONE_VAR)), 0, "size done not updated");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("update after the save interval has passed");
+
+        progress->timeBegin -= 2000;
+        progress->timeSave -= PROGRESS_SAVE_INTERVAL_MSEC;
+        progress->workerList[0].timeBegin -= 1000;
+
+        TEST_RESULT_VOID(progressUpdate(progress, 4096), "update");
+
+        TEST_ASSIGN(status, progressLoad(stanza, STRDEF("restore")), "load status");
+        TEST_RESULT_UINT(varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_DONE_VAR)), 4096, "check size done");
+        TEST_RESULT_BOOL(varUInt64Force(kvGet(status, PROGRESS_KEY_RATE_VAR)) > 0, true, "check rate");
+        TEST_RESULT_BOOL(kvGet(status, PROGRESS_KEY_ETA_VAR) != NULL, true, "check eta");
+        TEST_RESULT_STR_Z(
+            jsonFromVar(kvGet(status, PROGRESS_KEY_WORKER_VAR)),
+            "[{\"file\":\"pg_data/base/1/1\",\"time\":1},{\"file\":null}]", "check workers");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("size done past the total is clamped");
+
+        progress->timeSave -= PROGRESS_SAVE_INTERVAL_MSEC;
+
+        TEST_RESULT_VOID(progressUpdate(progress, 9000), "update");
+
+        TEST_ASSIGN(status, progressLoad(stanza, STRDEF("restore")), "load status");
+        TEST_RESULT_UINT(varUInt64Force(kvGet(status, PROGRESS_KEY_SIZE_DONE_VAR)), 8192, "check size done");
+        TEST_RESULT_UINT(varUInt64Force(kvGet(status, PROGRESS_KEY_ETA_VAR)), 0, "check eta");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("status file write error is a warning");
+
+        const String *progressFileSave = progress->file;
+        storagePutP(storageNewWriteP(storageData, STRDEF("file")), NULL);
+        progress->file = strNewFmt("%s/file/status", testDataPath());
+        progress->timeSave -= PROGRESS_SAVE_INTERVAL_MSEC;
+
+        TEST_RESULT_VOID(progressUpdate(progress, 8192), "update");
+        TEST_RESULT_LOG(
+            "P00   WARN: unable to write progress status file '{[path-data]}/file/status': [FileOpenError] unable to open file"
+                " '{[path-data]}/file/status' for write: [20] Not a directory");
+
+        progress->timeSave -= PROGRESS_SAVE_INTERVAL_MSEC;
+
+        TEST_RESULT_VOID(progressUpdate(progress, 8192), "update without repeating the warning");
+
+        progress->file = progressFileSave;
+        progress->timeSave -= PROGRESS_SAVE_INTERVAL_MSEC;
+
+        TEST_RESULT_VOID(progressUpdate(progress, 8192), "update after the error clears");
+        TEST_RESULT_BOOL(progress->saveError, false, "check save error cleared");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("status file removed on free");
+
+        TEST_RESULT_VOID(progressFree(progress), "free progress");
+        TEST_RESULT_BOOL(storageExistsP(storageData, progressFile), false, "status file removed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("status file ignored when the process is gone");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Create the progress file and exit without freeing it
+                progressNew(8192, 1);
+            }
+            HARNESS_FORK_CHILD_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_BOOL(storageExistsP(storageData, progressFile), true, "status file exists");
+        TEST_RESULT_PTR(progressLoad(stanza, STRDEF("restore")), NULL, "status file ignored");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
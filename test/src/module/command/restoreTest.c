@@ -6,6 +6,7 @@ Test Restore Command
 #include "common/io/io.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "info/manifest.h"
 #include "postgres/version.h"
 #include "storage/posix/storage.h"
 #include "storage/helper.h"
@@ -180,16 +181,16 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("sparse-zero"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 0x10000000000UL, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, true, 0x10000000000UL, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
             false, "zero sparse 1TB file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), strNew("sparse-zero")).size, 0x10000000000UL, "    check size");
 
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("normal-zero"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 0, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, false, NULL, false, true),
             true, "zero-length file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), strNew("normal-zero")).size, 0, "    check size");
 
@@ -206,8 +207,8 @@ testRun(void)
         TEST_ERROR(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, strNew("normal"),
-                strNew("ffffffffffffffffffffffffffffffffffffffff"), false, 7, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, strNew("badpass")),
+                strNew("ffffffffffffffffffffffffffffffffffffffff"), 0, false, 7, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, false, strNew("badpass"), false, true),
             ChecksumError,
             "error restoring 'normal': actual checksum 'd1cd8a7d11daa26814b93eb604e1d49ab4b43770' does not match expected checksum"
                 " 'ffffffffffffffffffffffffffffffffffffffff'");
@@ -221,8 +222,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, strNew("normal"),
-                strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), false, 7, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, strNew("badpass")),
+                strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), 0, false, 7, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, false, strNew("badpass"), false, true),
             true, "copy file");
 
         StorageInfo info = storageInfoP(storagePg(), strNew("normal"));
@@ -234,6 +235,18 @@ testRun(void)
         TEST_RESULT_STR_Z(info.group, testGroup(), "    check group");
         TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("normal")))), "acefile", "    check contents");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy file decoded on the repo host");
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, strNew("normal-decode"),
+                strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), 0, false, 7, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, false, strNew("badpass"), true, false),
+            true, "copy file");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("normal-decode")))), "acefile", "    check contents");
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Create a repo file
         storagePutP(
@@ -244,8 +257,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
             true, "sha1 delta missing");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -256,8 +269,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
             false, "sha1 delta existing");
 
         ioBufferSizeSet(oldBufferSize);
@@ -265,8 +278,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 1557432155, true, true, NULL, false, true),
             false, "sha1 delta force existing");
 
         // Change the existing file so it no longer matches by size
@@ -275,8 +288,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
             true, "sha1 delta existing, size differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -286,8 +299,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 1557432155, true, true, NULL, false, true),
             true, "delta force existing, size differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -298,8 +311,8 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
             true, "sha1 delta existing, content differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -309,15 +322,15 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 1557432155, true, true, NULL, false, true),
             true, "delta force existing, timestamp differs");
 
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432153, true, true, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 1557432153, true, true, NULL, false, true),
             true, "delta force existing, timestamp after copy time");
 
         // Change the existing file to zero-length
@@ -326,10 +339,132 @@ testRun(void)
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
-                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 0, false, 0, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
             false, "sha1 delta existing, content differs");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta falls back to a full copy when block checksums are missing");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block")), BUFSTRDEF("btestfile"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("block"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 4, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
+            true, "sha1 delta existing, content differs");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("block")))), "atestfile", "    check contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta rewrites changed blocks");
+
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(),
+                strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(repoFileReferenceFull), strZ(repoFile1))),
+            BUFSTRDEF(
+                "716845cc31b39d291855cdce64e5450b258da84d3bc871674af87645b1c6ad82c664004a650c20c0"
+                "58e6b3a414a1e090dfc6029add0f3555ccba127f"));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block")), BUFSTRDEF("btestfilx"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("block"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 4, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
+            true, "sha1 delta existing, blocks differ");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("block")))), "atestfile", "    check contents");
+        TEST_RESULT_INT(storageInfoP(storagePg(), strNew("block")).timeModified, 1557432154, "    check time");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block")), BUFSTRDEF("atestfilx"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("block"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 4, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 1557432155, true, true, NULL, false, false),
+            true, "delta force existing, blocks differ");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("block")))), "atestfile", "    check contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta only sets time when all blocks match");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block"), .timeModified = 1557432100), BUFSTRDEF("atestfile"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("block"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 4, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 1557432155, true, true, NULL, false, true),
+            false, "delta force existing, timestamp differs");
+        TEST_RESULT_INT(storageInfoP(storagePg(), strNew("block")).timeModified, 1557432154, "    check time");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta with compressed and encrypted repo file");
+
+        const String *repoFile2 = strNew("pg_data/testfile2");
+
+        ceRepoFile = storageNewWriteP(
+            storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strZ(repoFileReferenceFull), strZ(repoFile2)));
+        filterGroup = ioWriteFilterGroup(storageWriteIo(ceRepoFile));
+        ioFilterGroupAdd(filterGroup, compressFilter(compressTypeGz, 3));
+        ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("badpass"), NULL));
+
+        storagePutP(ceRepoFile, BUFSTRDEF("acefile"));
+
+        StorageWrite *ceBlockFile = storageNewWriteP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(repoFileReferenceFull), strZ(repoFile2)));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(ceBlockFile)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("badpass"), NULL));
+
+        storagePutP(ceBlockFile, BUFSTRDEF("c42c3edc13c5a65b9f6c12ca512a925616bc6bf1553d12fb29612fcb6bc8a658ae15a349cbcf5f6c"));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block2")), BUFSTRDEF("acefilx"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile2, repoIdx, repoFileReferenceFull, compressTypeGz, strNew("block2"),
+                strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), 4, false, 7, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, strNew("badpass"), false, true),
+            true, "sha1 delta existing, blocks differ");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("block2")))), "acefile", "    check contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta error when repo file does not match checksum");
+
+        const String *repoFileReferenceDiff = strNew("20190509F_20190510D");
+
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(repoFileReferenceDiff), strZ(repoFile1))),
+            BUFSTRDEF("btestfile0123"));
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(),
+                strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_PATH_BLOCK "/%s", strZ(repoFileReferenceDiff), strZ(repoFile1))),
+            BUFSTRDEF(
+                "716845cc31b39d291855cdce64e5450b258da84d3bc871674af87645b1c6ad82c664004a650c20c0"
+                "58e6b3a414a1e090dfc6029add0f3555ccba127f"));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block")), BUFSTRDEF("atestfilx"));
+
+        TEST_ERROR(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceDiff, compressTypeNone, strNew("block"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), 4, false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, NULL, false, true),
+            ChecksumError,
+            "error restoring 'block': actual checksum '670750d2eddeb9352894dd5f448efdfffeda09e3' does not match expected checksum"
+                " '9bc8ab2dda60ef4beed07d1e19ce0676d5edde67'");
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         VariantList *paramList = varLstNew();
@@ -339,6 +474,7 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(compressTypeNone));
         varLstAdd(paramList, varNewStrZ("protocol"));
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));
+        varLstAdd(paramList, varNewUInt(0));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewUInt64(9));
         varLstAdd(paramList, varNewUInt64(1557432100));
@@ -349,6 +485,8 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewBool(true));
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":true}\n", "    check result");
@@ -371,6 +509,7 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(compressTypeNone));
         varLstAdd(paramList, varNewStrZ("protocol"));
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));
+        varLstAdd(paramList, varNewUInt(0));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewUInt64(9));
         varLstAdd(paramList, varNewUInt64(1557432100));
@@ -381,11 +520,30 @@ testRun(void)
         varLstAdd(paramList, varNewBool(true));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewBool(true));
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sync restored files");
+
+        StringList *syncList = strLstNew();
+        strLstAddZ(syncList, "missing");
+
+        TEST_ERROR_FMT(restoreFileSync(syncList), FileMissingError, "unable to sync missing file '%s/pg/missing'", testPath());
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStrZ("protocol"));
+        varLstAdd(paramList, varNewStr(storagePathP(storagePg(), strNew("sparse-zero"))));
+
+        TEST_RESULT_BOOL(
+            restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_SYNC_STR, paramList, server), true, "protocol restore file sync");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{}\n", "    check result");
+        bufUsedSet(serverWrite, 0);
+
         // Check invalid protocol function
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_BOOL(restoreProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid function");
@@ -1295,6 +1453,7 @@ testRun(void)
             manifestDbAdd(manifest, &(ManifestDb){.name = STRDEF(UTF8_DB_NAME), .id = 16384, .lastSystemId = 12168});
             manifestFileAdd(
                 manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/1/" PG_FILE_PGVERSION)});
+            lstSort(manifest->fileList, sortOrderAsc);
         }
         MEM_CONTEXT_END();
 
@@ -1309,6 +1468,7 @@ testRun(void)
         {
             manifestFileAdd(
                 manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/16384/" PG_FILE_PGVERSION)});
+            lstSort(manifest->fileList, sortOrderAsc);
         }
         MEM_CONTEXT_END();
 
@@ -1350,6 +1510,10 @@ testRun(void)
             manifestDbAdd(manifest, &(ManifestDb){.name = STRDEF("test2"), .id = 32768, .lastSystemId = 12168});
             manifestFileAdd(
                 manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/32768/" PG_FILE_PGVERSION)});
+            manifestFileAdd(
+                manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/pgsql_tmp/" PG_FILE_PGVERSION)});
+            manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/bogus")});
+            lstSort(manifest->fileList, sortOrderAsc);
         }
         MEM_CONTEXT_END();
 
@@ -1373,6 +1537,7 @@ testRun(void)
                     .path = STRDEF("/ts1")});
             manifestFileAdd(
                 manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_BASE "/32768/" PG_FILE_PGVERSION)});
+            lstSort(manifest->fileList, sortOrderAsc);
         }
         MEM_CONTEXT_END();
 
@@ -1392,6 +1557,7 @@ testRun(void)
             manifestFileAdd(
                 manifest, &(ManifestFile){
                     .name = STRDEF(MANIFEST_TARGET_PGTBLSPC "/16387/PG_9.4_201409291/65536/" PG_FILE_PGVERSION)});
+            lstSort(manifest->fileList, sortOrderAsc);
         }
         MEM_CONTEXT_END();
 
@@ -2150,6 +2316,7 @@ testRun(void)
         strLstAdd(argList, strNewFmt("--repo1-path=%s", strZ(repoPath)));
         strLstAdd(argList, strNewFmt("--pg1-path=%s", strZ(pgPath)));
         strLstAddZ(argList, "--delta");
+        strLstAddZ(argList, "--sync-defer");
         strLstAddZ(argList, "--type=none");
         strLstAddZ(argList, "--link-map=pg_wal=../wal");
         strLstAddZ(argList, "--link-map=postgresql.conf=../config/postgresql.conf");
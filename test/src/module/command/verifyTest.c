@@ -887,14 +887,15 @@ testRun(void)
 
         String *filePathName =  strNewFmt(STORAGE_REPO_ARCHIVE "/testfile");
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRDEF("")), "put zero-sized file");
-        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, NULL), verifyOk, "file ok");
+        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, NULL, NULL, NULL, 0), verifyOk, "file ok");
 
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRZ(fileContents)), "put file");
 
-        TEST_RESULT_UINT(verifyFile(filePathName, fileChecksum, 0, NULL), verifySizeInvalid, "file size invalid");
+        TEST_RESULT_UINT(verifyFile(filePathName, fileChecksum, 0, NULL, NULL, NULL, 0), verifySizeInvalid, "file size invalid");
         TEST_RESULT_UINT(
             verifyFile(
-                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), fileChecksum, 0, NULL), verifyFileMissing, "file missing");
+                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), fileChecksum, 0, NULL, NULL, NULL, 0), verifyFileMissing,
+            "file missing");
 
         // Create a compressed encrypted repo file
         filePathName = strNew(STORAGE_REPO_BACKUP "/testfile.gz");
@@ -905,12 +906,76 @@ testRun(void)
         TEST_RESULT_VOID(storagePutP(write, BUFSTRZ(fileContents)), "write encrypted, compressed file");
 
         TEST_RESULT_UINT(
-            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass")), verifyOk, "file encrypted compressed ok");
+            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass"), NULL, NULL, 0), verifyOk,
+            "file encrypted compressed ok");
         TEST_RESULT_UINT(
             verifyFile(
-                filePathName, strNew("badchecksum"), fileSize, strNew("pass")), verifyChecksumMismatch,
+                filePathName, strNew("badchecksum"), fileSize, strNew("pass"), NULL, NULL, 0), verifyChecksumMismatch,
                 "file encrypted compressed checksum mismatch");
 
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("verifyFile() with block checksums");
+
+        // Block checksums of a file with two full blocks and a partial block
+        const String *blockPathName = STRDEF(STORAGE_REPO_BACKUP "/block/testfile");
+        const Buffer *blockChecksum = BUFSTRDEF(
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+            "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"
+            "cccccccccccccccccccccccccccccccccccccccc");
+        const String *blockChecksumSha1 = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, blockChecksum));
+        const unsigned int blockSize = (unsigned int)(fileSize - 1) / 2;
+
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass"), blockPathName, blockChecksumSha1, blockSize),
+            verifyFileMissing, "block checksums missing");
+
+        write = storageNewWriteP(storageRepoWrite(), blockPathName);
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+        TEST_RESULT_VOID(storagePutP(write, blockChecksum), "write encrypted block checksums");
+
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass"), blockPathName, blockChecksumSha1, blockSize),
+            verifyOk, "file and block checksums ok");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass"), blockPathName, STRDEF("badchecksum"), blockSize),
+            verifyChecksumMismatch, "block checksums checksum mismatch");
+        TEST_RESULT_UINT(
+            verifyFile(
+                filePathName, fileChecksum, fileSize, strNew("pass"), blockPathName, blockChecksumSha1, (unsigned int)fileSize),
+            verifySizeInvalid, "block checksums size invalid");
+        TEST_RESULT_UINT(
+            verifyFile(
+                filePathName, STRDEF("badchecksum"), fileSize, strNew("pass"), blockPathName, STRDEF("badchecksum"), blockSize),
+            verifyChecksumMismatch, "file checksum mismatch reported before block checksums");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("verifyFile() with a trimmed WAL segment");
+
+        // Create a 1MB WAL segment with data in the first 64KB and a zero tail
+        Buffer *walBuffer = bufNew(1024 * 1024);
+        bufUsedSet(walBuffer, bufSize(walBuffer));
+        memset(bufPtr(walBuffer), 0, bufSize(walBuffer));
+        memset(bufPtr(walBuffer), 0xFF, 64 * 1024);
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .size = 1024 * 1024, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer);
+        const String *walChecksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer));
+
+        const String *walPathName = strNewFmt(
+            STORAGE_REPO_ARCHIVE "/11-1/0000000100000001/000000010000000100000001-%s.trim", strZ(walChecksum));
+        TEST_RESULT_VOID(
+            storagePutP(storageNewWriteP(storageRepoWrite(), walPathName), BUF(bufPtr(walBuffer), 64 * 1024)),
+            "put trimmed WAL segment");
+        TEST_RESULT_UINT(verifyFile(walPathName, walChecksum, 1024 * 1024, NULL, NULL, NULL, 0), verifyOk, "trimmed WAL ok");
+
+        walPathName = strNewFmt(STORAGE_REPO_ARCHIVE "/11-1/0000000100000001/000000010000000100000002-%s", strZ(walChecksum));
+        TEST_RESULT_VOID(
+            storagePutP(storageNewWriteP(storageRepoWrite(), walPathName), BUF(bufPtr(walBuffer), 64 * 1024)),
+            "put short WAL segment without the trim extension");
+        TEST_RESULT_UINT(
+            verifyFile(walPathName, walChecksum, 1024 * 1024, NULL, NULL, NULL, 0), verifyChecksumMismatch,
+            "short WAL is not padded");
+
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("verifyProtocol()");
 
@@ -926,6 +991,9 @@ testRun(void)
         varLstAdd(paramList, varNewStr(fileChecksum));
         varLstAdd(paramList, varNewUInt64(fileSize));
         varLstAdd(paramList, varNewStrZ("pass"));
+        varLstAdd(paramList, varNewStr(blockPathName));
+        varLstAdd(paramList, varNewStr(blockChecksumSha1));
+        varLstAdd(paramList, varNewUInt(blockSize));
 
         TEST_RESULT_BOOL(verifyProtocol(PROTOCOL_COMMAND_VERIFY_FILE_STR, paramList, server), true, "protocol verify file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":0}\n", "check result");
@@ -1506,7 +1574,12 @@ testRun(void)
         TEST_RESULT_VOID(
             storagePutP(storageNewWriteP(storageTest, manifestFileCopyDiff), contentLoad), "write valid manifest copy - diff");
 
-        // Create valid full backup and valid diff backup
+        // Create valid full backup and valid diff backup. The valid file has block checksums which are verified with it.
+        const Buffer *blockChecksum = BUFSTRDEF(
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+            "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"
+            "cccccccccccccccccccccccccccccccccccccccc");
+
         contentLoad = harnessInfoChecksumZ
         (
             strZ(strNewFmt(
@@ -1519,13 +1592,14 @@ testRun(void)
                 TEST_MANIFEST_DB
                 "\n"
                 "[target:file]\n"
-                "pg_data/validfile={\"checksum\":\"%s\",\"master\":true,\"size\":%u,\"timestamp\":1565282114}\n"
+                "pg_data/validfile={\"checksum\":\"%s\",\"checksum-block\":3,\"checksum-block-sha1\":\"%s\",\"master\":true"
+                    ",\"size\":%u,\"timestamp\":1565282114}\n"
                 TEST_MANIFEST_FILE_DEFAULT
                 TEST_MANIFEST_LINK
                 TEST_MANIFEST_LINK_DEFAULT
                 TEST_MANIFEST_PATH
                 TEST_MANIFEST_PATH_DEFAULT,
-                strZ(fileChecksum), (unsigned int)fileSize))
+                strZ(fileChecksum), strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, blockChecksum))), (unsigned int)fileSize))
         );
 
         manifestFile = strNewFmt("%s/%s/" BACKUP_MANIFEST_FILE, strZ(backupStanzaPath), strZ(backupLabelFullDb2));
@@ -1536,6 +1610,12 @@ testRun(void)
             storagePutP(storageNewWriteP(storageTest, manifestFileCopy), contentLoad), "write valid manifest copy - full");
         filePathName =  strNewFmt(STORAGE_REPO_BACKUP "/%s/pg_data/validfile", strZ(backupLabelFullDb2));
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRZ(fileContents)), "put valid file");
+        TEST_RESULT_VOID(
+            storagePutP(
+                storageNewWriteP(
+                    storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/block/pg_data/validfile", strZ(backupLabelFullDb2))),
+                blockChecksum),
+            "put valid file block checksums");
 
         // Create WAL file with just header info and small WAL size
         Buffer *walBuffer = bufNew((size_t)(1024 * 1024));
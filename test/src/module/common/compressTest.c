@@ -196,6 +196,26 @@ testRun(void)
         TEST_ERROR(gzError(Z_VERSION_ERROR), FormatError, "zlib threw error: [-6] incompatible version");
         TEST_ERROR(gzError(999), AssertError, "zlib threw error: [999] unknown error");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("output of command-line tool can be decompressed");
+
+        Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+        Buffer *gzipData = bufNew(256 * 1024);
+
+        for (size_t chrIdx = 0; chrIdx < bufSize(gzipData); chrIdx++)
+            bufPtr(gzipData)[chrIdx] = (unsigned char)(chrIdx % 17 + 'a');
+
+        bufUsedSet(gzipData, bufSize(gzipData));
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("gzip.txt")), gzipData);
+        TEST_SYSTEM("gzip -9 {[path]}/gzip.txt");
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                gzipData,
+                testDecompress(gzDecompressNew(), storageGetP(storageNewReadP(storageTest, STRDEF("gzip.txt.gz"))), 1024, 1024)),
+            true, "decompress gzip -9 output");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("gzDecompressToLog() and gzCompressToLog()");
 
@@ -376,11 +396,67 @@ testRun(void)
         TEST_RESULT_STR_Z(compressExtStrip(STRDEF("file"), compressTypeNone), "file", "nothing to strip");
         TEST_RESULT_STR_Z(compressExtStrip(STRDEF("file.gz"), compressTypeGz), "file", "strip gz");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressProbe()");
+
+        TEST_RESULT_BOOL(compressProbe(bufNew(0)), true, "empty sample is compressible");
+
+        Buffer *sample = bufNew(COMPRESS_PROBE_SIZE);
+        memset(bufPtr(sample), 0, bufSize(sample));
+        bufUsedSet(sample, bufSize(sample));
+
+        TEST_RESULT_BOOL(compressProbe(sample), true, "zeroed sample is compressible");
+
+        for (size_t sampleIdx = 0; sampleIdx < bufSize(sample); sampleIdx++)
+            bufPtr(sample)[sampleIdx] = (unsigned char)('a' + sampleIdx % 26);
+
+        TEST_RESULT_BOOL(compressProbe(sample), true, "text sample is compressible");
+
+        uint32_t seed = 1;
+
+        for (size_t sampleIdx = 0; sampleIdx < bufSize(sample); sampleIdx++)
+        {
+            seed = seed * 1103515245 + 12345;
+            bufPtr(sample)[sampleIdx] = (unsigned char)(seed >> 16);
+        }
+
+        TEST_RESULT_BOOL(compressProbe(sample), false, "random sample is not compressible");
+
+        // Half random and half zeroed is still worth compressing
+        memset(bufPtr(sample), 0, bufSize(sample) / 2);
+
+        TEST_RESULT_BOOL(compressProbe(sample), true, "partly random sample is compressible");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("compressLevelDefault()");
 
         TEST_RESULT_INT(compressLevelDefault(compressTypeNone), 0, "none level=0");
         TEST_RESULT_INT(compressLevelDefault(compressTypeGz), 6, "gz level=6");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressLevelAdaptive() and compressLevelAdaptiveUpdate()");
+
+        TEST_RESULT_VOID(compressLevelAdaptiveUpdate(compressTypeGz, 5000, 0), "update before init is ignored");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 0), 1, "init clamps to min level");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 6), 1, "level is not reinitialized");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeBz2, 12), 9, "new type clamps to max level");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 8, "new type reinitializes");
+
+        TEST_RESULT_VOID(compressLevelAdaptiveUpdate(compressTypeGz, 100, 800), "not enough time to adjust");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 8, "level not changed");
+        TEST_RESULT_VOID(compressLevelAdaptiveUpdate(compressTypeGz, 0, 100), "sink is the bottleneck");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 9, "level raised");
+        TEST_RESULT_VOID(compressLevelAdaptiveUpdate(compressTypeGz, 0, 1000), "sink is the bottleneck");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 9, "level not raised past max");
+        TEST_RESULT_VOID(compressLevelAdaptiveUpdate(compressTypeGz, 600, 400), "balanced");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 9, "level not changed");
+        TEST_RESULT_VOID(compressLevelAdaptiveUpdate(compressTypeBz2, 1000, 0), "different type is ignored");
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 9, "level not changed");
+
+        for (int levelIdx = 0; levelIdx < 9; levelIdx++)
+            compressLevelAdaptiveUpdate(compressTypeGz, 1000, 0);
+
+        TEST_RESULT_INT(compressLevelAdaptive(compressTypeGz, 8), 1, "level lowered to min when compression is the bottleneck");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -1,6 +1,7 @@
 /***********************************************************************************************************************************
 Test Block Cipher
 ***********************************************************************************************************************************/
+#include "common/io/bufferRead.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/io/io.h"
 #include "common/type/json.h"
@@ -49,10 +50,12 @@ testRun(void)
         TEST_ERROR(cipherType(strNew(BOGUS_STR)), AssertError, "invalid cipher name 'BOGUS'");
         TEST_RESULT_UINT(cipherType(strNew("none")), cipherTypeNone, "none type");
         TEST_RESULT_UINT(cipherType(strNew("aes-256-cbc")), cipherTypeAes256Cbc, "aes-256-cbc type");
+        TEST_RESULT_UINT(cipherType(strNew("aes-256-gcm")), cipherTypeAes256Gcm, "aes-256-gcm type");
 
-        TEST_ERROR(cipherTypeName((CipherType)2), AssertError, "invalid cipher type 2");
+        TEST_ERROR(cipherTypeName((CipherType)3), AssertError, "invalid cipher type 3");
         TEST_RESULT_STR_Z(cipherTypeName(cipherTypeNone), "none", "none name");
         TEST_RESULT_STR_Z(cipherTypeName(cipherTypeAes256Cbc), "aes-256-cbc", "aes-256-cbc name");
+        TEST_RESULT_STR_Z(cipherTypeName(cipherTypeAes256Gcm), "aes-256-gcm", "aes-256-gcm name");
 
         // Test if the buffer was overrun
         // -------------------------------------------------------------------------------------------------------------------------
@@ -286,6 +289,101 @@ testRun(void)
 
         ioFilterFree(blockDecryptFilter);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("encrypt and decrypt chunked format");
+
+        // Two full chunks and a partial chunk
+        Buffer *plainBuffer = bufNew(CIPHER_BLOCK_CHUNK_SIZE * 2 + 100);
+
+        for (size_t plainIdx = 0; plainIdx < bufSize(plainBuffer); plainIdx++)
+            bufPtr(plainBuffer)[plainIdx] = (unsigned char)(plainIdx % 251);
+
+        bufUsedSet(plainBuffer, bufSize(plainBuffer));
+
+        IoRead *read = ioBufferReadNew(plainBuffer);
+        ioFilterGroupAdd(
+            ioReadFilterGroup(read),
+            cipherBlockNewVar(ioFilterParamList(cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, testPass, NULL))));
+        ioReadOpen(read);
+
+        Buffer *chunkBuffer = NULL;
+        TEST_ASSIGN(chunkBuffer, ioReadBuf(read), "encrypt");
+        TEST_RESULT_UINT(
+            bufUsed(chunkBuffer), CIPHER_BLOCK_HEADER_SIZE + bufUsed(plainBuffer) + CIPHER_BLOCK_CHUNK_TAG_SIZE * 3,
+            "    check size");
+        TEST_RESULT_BOOL(
+            memcmp(bufPtr(chunkBuffer), CIPHER_BLOCK_CHUNK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0, true, "    check magic");
+
+        // Decrypt with the cipher type the file was written with
+        read = ioBufferReadNew(chunkBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(read), plainBuffer), true, "decrypt");
+
+        // Decrypt in small reads with another cipher type since the format is determined by the header
+        ioBufferSizeSet(1000);
+
+        read = ioBufferReadNew(chunkBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(read), plainBuffer), true, "decrypt in small reads");
+
+        ioBufferSizeSet(65536);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error on modified chunk");
+
+        Buffer *badBuffer = bufDup(chunkBuffer);
+        bufPtr(badBuffer)[CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_CHUNK_SIZE + 100]++;
+
+        read = ioBufferReadNew(badBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), CryptoError, "cipher chunk authentication failed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error on missing final chunk");
+
+        badBuffer = bufDup(chunkBuffer);
+        bufUsedSet(badBuffer, bufUsed(badBuffer) - 100 - CIPHER_BLOCK_CHUNK_TAG_SIZE);
+
+        read = ioBufferReadNew(badBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), CryptoError, "cipher chunk authentication failed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error on chunk shorter than tag");
+
+        badBuffer = bufDup(chunkBuffer);
+        bufUsedSet(badBuffer, CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE - 1);
+
+        read = ioBufferReadNew(badBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), CryptoError, "cipher chunk is truncated");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("encrypt and decrypt zero byte file");
+
+        read = ioBufferReadNew(bufNew(0));
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_ASSIGN(chunkBuffer, ioReadBuf(read), "encrypt");
+        TEST_RESULT_UINT(bufUsed(chunkBuffer), CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE, "    check size");
+
+        read = ioBufferReadNew(chunkBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL));
+        ioReadOpen(read);
+
+        TEST_RESULT_UINT(bufUsed(ioReadBuf(read)), 0, "decrypt");
+
         // Helper function
         // -------------------------------------------------------------------------------------------------------------------------
         IoFilterGroup *filterGroup = ioFilterGroupNew();
@@ -387,5 +485,40 @@ testRun(void)
             "    check hmac");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("CryptoHashBlock"))
+    {
+        IoFilter *hashBlock = NULL;
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("no data");
+
+        TEST_ASSIGN(hashBlock, cryptoHashBlockNew(5), "create block hash");
+        TEST_RESULT_STR_Z(varStr(ioFilterResult(hashBlock)), "", "check empty hash list");
+        TEST_RESULT_VOID(ioFilterFree(hashBlock), "free block hash");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("input split across blocks with a partial last block");
+
+        TEST_ASSIGN(hashBlock, cryptoHashBlockNewVar(varVarLst(jsonToVar(STRDEF("[5]")))), "create block hash");
+        TEST_RESULT_VOID(ioFilterProcessIn(hashBlock, BUFSTRDEF("12")), "add 12");
+        TEST_RESULT_VOID(ioFilterProcessIn(hashBlock, BUFSTRDEF("345")), "add 345");
+        TEST_RESULT_VOID(ioFilterProcessIn(hashBlock, BUFSTRDEF("67")), "add 67");
+        TEST_RESULT_STR_Z(
+            varStr(ioFilterResult(hashBlock)),
+            "8cb2237d0679ca88db6464eac60da96345513964" "4d89d294cd4ca9f2ca57dc24a53ffb3ef5303122", "check hash list");
+        TEST_RESULT_VOID(ioFilterFree(hashBlock), "free block hash");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("input spans several blocks and ends on a block boundary");
+
+        TEST_ASSIGN(hashBlock, cryptoHashBlockNew(5), "create block hash");
+        TEST_RESULT_VOID(ioFilterProcessIn(hashBlock, BUFSTRDEF("1234567890")), "add 1234567890");
+        TEST_RESULT_STR_Z(
+            varStr(ioFilterResult(hashBlock)),
+            "8cb2237d0679ca88db6464eac60da96345513964" "230991abcd77e8173edb0af392e1f11120051e29", "check hash list");
+        TEST_RESULT_VOID(ioFilterFree(hashBlock), "free block hash");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
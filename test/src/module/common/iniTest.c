@@ -2,6 +2,7 @@
 Test Ini
 ***********************************************************************************************************************************/
 #include "common/io/bufferRead.h"
+#include "common/io/io.h"
 #include "common/type/buffer.h"
 #include "storage/posix/storage.h"
 
@@ -9,9 +10,8 @@ Test Ini
 Test callback to accumulate ini load results
 ***********************************************************************************************************************************/
 static void
-testIniLoadCallback(void *data, const String *section, const String *key, const String *value, const Variant *valueVar)
+testIniLoadCallback(void *data, const String *section, const String *key, const String *value)
 {
-    ASSERT(strEq(value, jsonFromVar(valueVar)));
     strCatFmt((String *)data, "%s:%s:%s\n", strZ(section), strZ(key), strZ(value));
 }
 
@@ -110,6 +110,31 @@ testRun(void)
             "section1:key2:\"value2\"\n"
             "section2:#key2:\"value2\"\n",
             "    check ini");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("lines split across reads and longer than the buffer");
+
+        const size_t bufferSizeOld = ioBufferSize();
+        ioBufferSizeSet(8);
+
+        iniBuf = BUFSTRZ(
+            "[section1]\n"
+            "key1=\"value1\"\n"
+            "key2={\"a\":\"a very long value that does not fit\"}\n"
+            "\n"
+            "[s2]\n"
+            "k=1\n");
+        result = strNew("");
+
+        TEST_RESULT_VOID(iniLoad(ioBufferReadNew(iniBuf), testIniLoadCallback, result), "load ini");
+        TEST_RESULT_STR_Z(
+            result,
+            "section1:key1:\"value1\"\n"
+            "section1:key2:{\"a\":\"a very long value that does not fit\"}\n"
+            "s2:k:1\n",
+            "    check ini");
+
+        ioBufferSizeSet(bufferSizeOld);
     }
 
     // *****************************************************************************************************************************
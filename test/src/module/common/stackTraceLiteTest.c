@@ -0,0 +1,114 @@
+/***********************************************************************************************************************************
+Test Lite Stack Trace Handler
+***********************************************************************************************************************************/
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("stackTracePush(), stackTracePop(), and stackTraceClean()"))
+    {
+        char buffer[8192];
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("check size of StackTraceData");
+
+        TEST_RESULT_UINT(sizeof(StackTraceData), TEST_64BIT() ? 24 : 12, "check");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("parameters are not recorded");
+
+        stackTracePush("file1.c", "function1");
+        stackTraceParamLog();
+        stackTraceParamAdd((size_t)snprintf(stackTraceParamBuffer("param1"), STACK_TRACE_PARAM_MAX, "value1"));
+        TEST_RESULT_Z(stackTraceParam(), "lite build - parameters not recorded", "check param");
+        stackTracePop();
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("stack trace");
+
+        stackTraceToZ(buffer, sizeof(buffer), "file1.c", "function1", 99);
+        TEST_RESULT_Z(buffer, "file1:function1:99:(lite build - parameters not recorded)", "empty stack");
+
+        TRY_BEGIN()
+        {
+            stackTracePush("file1.c", "function1");
+            stackTracePush("file2.c", "function2");
+
+            stackTraceToZ(buffer, sizeof(buffer), "file2.c", "function2", 99);
+
+            TEST_RESULT_Z(
+                buffer,
+                "file2:function2:99:(lite build - parameters not recorded)\n"
+                "file1:function1:(lite build - parameters not recorded)",
+                "current function on top of stack");
+
+            stackTraceToZ(buffer, sizeof(buffer), "file3.c", "function3", 99);
+
+            TEST_RESULT_Z(
+                buffer,
+                "file3:function3:99:(lite build - parameters not recorded)\n"
+                "    ... function(s) omitted ...\n"
+                "file2:function2:(lite build - parameters not recorded)\n"
+                "file1:function1:(lite build - parameters not recorded)",
+                "current function not on top of stack");
+
+            TRY_BEGIN()
+            {
+                stackTracePush("file3.c", "function3");
+                TEST_RESULT_UINT(stackTraceLocal.stackSize, 3, "check stack size");
+
+                THROW(ConfigError, "test");
+            }
+            CATCH(ConfigError)
+            {
+                // Ignore the error since we are just testing stack cleanup
+            }
+            TRY_END();
+
+            TEST_RESULT_UINT(stackTraceLocal.stackSize, 2, "check stack size after clean");
+            THROW(ConfigError, "test");
+        }
+        CATCH(ConfigError)
+        {
+            // Ignore the error since we are just testing stack cleanup
+        }
+        TRY_END();
+
+        TEST_RESULT_UINT(stackTraceLocal.stackSize, 0, "check stack size after clean");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ring overflow");
+
+        for (unsigned int stackIdx = 0; stackIdx < STACK_TRACE_MAX + 2; stackIdx++)
+            stackTracePush(stackIdx < 2 ? "file1.c" : "file2.c", stackIdx < 2 ? "function1" : "function2");
+
+        stackTraceToZ(buffer, 128, "file2.c", "function2", 99);
+
+        TEST_RESULT_Z(
+            buffer,
+            "file2:function2:99:(lite build - parameters not recorded)\n"
+            "file2:function2:(lite build - parameters not recorded)\n"
+            "file2:function",
+            "truncated stack trace");
+
+        TEST_RESULT_UINT(
+            stackTraceToZ(buffer, sizeof(buffer), "file2.c", "function2", 99),
+            57 + (STACK_TRACE_MAX - 1) * 55 + 39, "check stack trace size");
+        TEST_RESULT_Z(
+            buffer + strlen(buffer) - 93,
+            "file2:function2:(lite build - parameters not recorded)\n"
+            "    ... 2 function(s) not recorded ...",
+            "oldest functions not recorded");
+
+        stackTraceClean(0);
+        TEST_RESULT_UINT(stackTraceLocal.stackSize, 0, "clean stack");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
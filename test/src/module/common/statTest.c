@@ -27,6 +27,31 @@ testRun(void)
         TEST_RESULT_UINT(lstSize(statLocalData.stat), 2, "stat list has two stats");
 
         TEST_RESULT_STR_Z(jsonFromKv(statToKv()), "{\"http.session\":{\"total\":1},\"tls.client\":{\"total\":2}}", "stat output");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("time and bytes");
+
+        const String *statBackupCopy = STRDEF("backup.copy");
+
+        TEST_RESULT_VOID(statTimeAdd(statTlsClient, 500), "add 0.5ms to tls.client");
+        TEST_RESULT_VOID(statTimeAdd(statTlsClient, 3500), "add 3.5ms to tls.client");
+        TEST_RESULT_VOID(statTimeAdd(statTlsClient, 1000), "add 1ms to tls.client");
+        TEST_RESULT_VOID(statBytesAdd(statBackupCopy, 8192), "add bytes to backup.copy");
+        TEST_RESULT_VOID(statBytesAdd(statBackupCopy, 8192), "add bytes to backup.copy");
+        TEST_RESULT_VOID(statTimeAdd(statBackupCopy, 9999999999999), "add huge time to backup.copy");
+        TEST_RESULT_BOOL(statTimeEnd(statHttpSession, timeUSec()) > 0, true, "end time for http.session");
+        TEST_RESULT_VOID(statTimeEnd(statHttpSession, UINT64_MAX), "end time for http.session before begin");
+        TEST_RESULT_UINT(lstSize(statLocalData.stat), 3, "stat list has three stats");
+
+        TEST_RESULT_STR_Z(
+            jsonFromKv(statToKv()),
+            "{"
+                "\"backup.copy\":{\"bytes\":16384"
+                    ",\"histogram\":[0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1],\"time\":9999999999,\"timeMax\":9999999999},"
+                "\"http.session\":{\"histogram\":[2],\"time\":0,\"timeMax\":0,\"total\":1},"
+                "\"tls.client\":{\"histogram\":[1,1,1],\"time\":5,\"timeMax\":3,\"total\":2}"
+            "}",
+            "stat output");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -20,16 +20,22 @@ testRun(void)
     }
 
     // *****************************************************************************************************************************
-    if (testBegin("sleepMSec()"))
+    if (testBegin("sleepMSec() and timeUSec()"))
     {
         // Sleep and measure time slept
         TimeMSec begin = timeMSec();
+        TimeUSec beginUSec = timeUSec();
         sleepMSec(1400);
+        TimeUSec endUSec = timeUSec();
         TimeMSec end = timeMSec();
 
         // Check bounds for time slept (within a range of .1 seconds)
         TEST_RESULT_BOOL(end - begin >= (TimeMSec)1400, true, "lower range check");
         TEST_RESULT_BOOL(end - begin < (TimeMSec)1500, true, "upper range check");
+
+        // Check bounds for monotonic time slept
+        TEST_RESULT_BOOL(endUSec - beginUSec >= (TimeUSec)1400000, true, "lower range check (usec)");
+        TEST_RESULT_BOOL(endUSec - beginUSec < (TimeUSec)1500000, true, "upper range check (usec)");
     }
 
     // *****************************************************************************************************************************
@@ -118,6 +118,122 @@ testRun(void)
         TEST_RESULT_STRLST_Z(strLstNewVarLst(jsonToVarLst(strNew("[\"e1\", \"e2\"]"))), "e1\ne2\n", "json list");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("JsonRead and jsonValidate()"))
+    {
+        TEST_TITLE("read object");
+
+        JsonRead *read = NULL;
+
+        TEST_ASSIGN(
+            read,
+            jsonReadNew(
+                strNew(
+                    " {\"bool\": true, \"int\":-2147483648, \"int64\" : -9223372036854775808, \"null\":null,\"str\":\"a\\\"b\","
+                    "\"uint\":4294967295,\"uint64\":18446744073709551615,\"var\":[1,{\"a\":\"b\"}],"
+                    "\"skip\":{\"a\":[true,null,\"\\u0041\",-1,{}]},\"str-null\":null} ")),
+            "new reader");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeObjectBegin, "object begin");
+        TEST_RESULT_VOID(jsonReadObjectBegin(read), "object begin");
+        TEST_RESULT_BOOL(jsonReadKeyMatchZ(read, "boo"), false, "key does not match prefix");
+        TEST_RESULT_BOOL(jsonReadKeyMatchZ(read, "boolean"), false, "key does not match longer");
+        TEST_RESULT_BOOL(jsonReadKeyMatchZ(read, "bool"), true, "key matches");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeBool, "bool type");
+        TEST_RESULT_BOOL(jsonReadBool(read), true, "bool");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "int", "key");
+        TEST_RESULT_INT(jsonReadInt(read), INT_MIN, "int");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "int64", "key");
+        TEST_RESULT_INT(jsonReadInt64(read), INT64_MIN, "int64");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "null", "key");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeNull, "null type");
+        TEST_RESULT_VOID(jsonReadNull(read), "null");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "str", "key");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeString, "string type");
+        TEST_RESULT_STR_Z(jsonReadStr(read), "a\"b", "str");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "uint", "key");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeNumber, "number type");
+        TEST_RESULT_UINT(jsonReadUInt(read), UINT_MAX, "uint");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "uint64", "key");
+        TEST_RESULT_UINT(jsonReadUInt64(read), UINT64_MAX, "uint64");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "var", "key");
+        TEST_RESULT_STR_Z(jsonFromVar(jsonReadVar(read)), "[1,{\"a\":\"b\"}]", "var");
+        TEST_RESULT_VOID(jsonReadSkip(read), "skip key and value");
+        TEST_RESULT_STR_Z(jsonReadKey(read), "str-null", "key");
+        TEST_RESULT_STR(jsonReadStr(read), NULL, "null str");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeObjectEnd, "object end");
+        TEST_RESULT_VOID(jsonReadObjectEnd(read), "object end");
+        TEST_RESULT_VOID(jsonReadFree(read), "free reader");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read array");
+
+        TEST_ASSIGN(read, jsonReadNew(strNew("[[], 1 ,\"x\"]")), "new reader");
+        TEST_RESULT_VOID(jsonReadArrayBegin(read), "array begin");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeArrayBegin, "array begin type");
+        TEST_RESULT_VOID(jsonReadArrayBegin(read), "array begin");
+        TEST_RESULT_UINT(jsonReadTypeNext(read), jsonTypeArrayEnd, "array end type");
+        TEST_RESULT_VOID(jsonReadArrayEnd(read), "array end");
+        TEST_RESULT_VOID(jsonReadSkip(read), "skip number");
+        TEST_RESULT_VOID(jsonReadSkip(read), "skip string");
+        TEST_RESULT_VOID(jsonReadArrayEnd(read), "array end");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read errors");
+
+        TEST_ERROR(jsonReadTypeNext(jsonReadNew(strNew(""))), JsonFormatError, "expected data");
+        TEST_ERROR(jsonReadTypeNext(jsonReadNew(strNew("z"))), JsonFormatError, "invalid type at 'z'");
+        TEST_ERROR(jsonReadObjectBegin(jsonReadNew(strNew("[]"))), JsonFormatError, "expected '{' at '[]'");
+        TEST_ERROR(jsonReadUInt(jsonReadNew(strNew("-1"))), JsonFormatError, "expected unsigned number at '-1'");
+        TEST_ERROR(jsonReadUInt(jsonReadNew(strNew("4294967296"))), JsonFormatError, "number is out of range at '4294967296'");
+        TEST_ERROR(
+            jsonReadUInt64(jsonReadNew(strNew("18446744073709551616"))), JsonFormatError,
+            "number is out of range at '18446744073709551616'");
+        TEST_ERROR(jsonReadInt(jsonReadNew(strNew("2147483648"))), JsonFormatError, "number is out of range at '2147483648'");
+        TEST_ERROR(
+            jsonReadInt64(jsonReadNew(strNew("9223372036854775808"))), JsonFormatError,
+            "number is out of range at '9223372036854775808'");
+        TEST_ERROR(jsonReadInt64(jsonReadNew(strNew("-x"))), JsonFormatError, "expected number at '-x'");
+
+        TEST_ASSIGN(read, jsonReadNew(strNew("{\"a\" 1}")), "new reader");
+        TEST_RESULT_VOID(jsonReadObjectBegin(read), "object begin");
+        TEST_ERROR(jsonReadKeyMatchZ(read, "a"), JsonFormatError, "expected ':' at '1}'");
+
+        TEST_ASSIGN(read, jsonReadNew(strNew("{1:1}")), "new reader");
+        TEST_RESULT_VOID(jsonReadObjectBegin(read), "object begin");
+        TEST_ERROR(jsonReadKeyMatchZ(read, "a"), JsonFormatError, "expected '\"' at '1:1}'");
+
+        TEST_ASSIGN(read, jsonReadNew(strNew("[1 2]")), "new reader");
+        TEST_RESULT_VOID(jsonReadArrayBegin(read), "array begin");
+        TEST_RESULT_UINT(jsonReadUInt(read), 1, "uint");
+        TEST_ERROR(jsonReadUInt(read), JsonFormatError, "expected ',' at '2]'");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("validate");
+
+        TEST_RESULT_VOID(
+            jsonValidate(strNew(" {\"a\":[1,-2,true,false,null,\"\\\"\\\\\\/\\b\\n\\r\\t\\f\\u00ff\",{}]} ")), "valid");
+
+        TEST_ERROR(jsonValidate(strNew("")), JsonFormatError, "expected data");
+        TEST_ERROR(jsonValidate(strNew("1 2")), JsonFormatError, "unexpected characters after JSON at '2'");
+        TEST_ERROR(jsonValidate(strNew("[1,]")), JsonFormatError, "expected value at ']'");
+        TEST_ERROR(jsonValidate(strNew("{\"a\":1,}")), JsonFormatError, "expected key at '}'");
+        TEST_ERROR(jsonValidate(strNew("{\"a\":}")), JsonFormatError, "expected value at '}'");
+        TEST_ERROR(jsonValidate(strNew("{\"a\":1]")), JsonFormatError, "expected ',' at ']'");
+        TEST_ERROR(jsonValidate(strNew("[1")), JsonFormatError, "expected data");
+        TEST_ERROR(jsonValidate(strNew("\"a")), JsonFormatError, "expected '\"' but found null delimiter");
+        TEST_ERROR(jsonValidate(strNew("\"\\x\"")), JsonFormatError, "invalid escape character 'x'");
+        TEST_ERROR(jsonValidate(strNew("\"\\u1234\"")), JsonFormatError, "unable to decode '1234'");
+        TEST_ERROR(jsonValidate(strNew("nul")), JsonFormatError, "expected null at 'nul'");
+        TEST_ERROR(jsonValidate(strNew("tru")), JsonFormatError, "expected boolean at 'tru'");
+
+        String *deep = strNew("");
+
+        for (unsigned int depthIdx = 0; depthIdx < 65; depthIdx++)
+            strCatZ(deep, "[");
+
+        TEST_ERROR(jsonValidate(deep), JsonFormatError, "nesting is deeper than 64 levels");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("jsonFromBool()"))
     {
@@ -30,6 +30,16 @@ testRun(void)
         TEST_RESULT_UINT(groupIdFromName(STRDEF("bogus")), (uid_t)-1, "get bogus group id");
         TEST_RESULT_STR_Z(groupName(), testGroup(), "check name name");
         TEST_RESULT_STR_Z(groupNameFromId(77777), NULL, "invalid group name by id");
+
+        TEST_RESULT_STR_Z(userNameFromIdCache(userId()), testUser(), "user name by id from cache");
+        TEST_RESULT_STR_Z(userNameFromIdCache(userId()), testUser(), "user name by id from cache again");
+        TEST_RESULT_STR_Z(userNameFromIdCache(77777), NULL, "invalid user name by id from cache");
+        TEST_RESULT_STR_Z(userNameFromIdCache(77777), NULL, "invalid user name by id from cache again");
+
+        TEST_RESULT_STR_Z(groupNameFromIdCache(groupId()), testGroup(), "group name by id from cache");
+        TEST_RESULT_STR_Z(groupNameFromIdCache(groupId()), testGroup(), "group name by id from cache again");
+        TEST_RESULT_STR_Z(groupNameFromIdCache(77777), NULL, "invalid group name by id from cache");
+        TEST_RESULT_STR_Z(groupNameFromIdCache(77777), NULL, "invalid group name by id from cache again");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -30,7 +30,7 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_UINT(sizeof(ManifestLoadFound), TEST_64BIT() ? 1 : 1, "check size of ManifestLoadFound");
         TEST_RESULT_UINT(sizeof(ManifestPath), TEST_64BIT() ? 32 : 16, "check size of ManifestPath");
-        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 120 : 92, "check size of ManifestFile");
+        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 136 : 104, "check size of ManifestFile");
     }
 
     // *****************************************************************************************************************************
@@ -1382,6 +1382,12 @@ testRun(void)
                .reference = STRDEF("20190101-010101F_20190202-010101D"),
                .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
 
+        TEST_ERROR(
+            manifestBuildIncr(manifest, manifestPrior, backupTypeIncr, NULL), AssertError,
+            "assertion 'manifestFileListSorted(manifestPrior)' failed");
+
+        lstSort(manifestPrior->fileList, sortOrderAsc);
+
         TEST_RESULT_VOID(manifestBuildIncr(manifest, manifestPrior, backupTypeIncr, NULL), "incremental manifest");
 
         contentSave = bufNew(0);
@@ -1541,11 +1547,6 @@ testRun(void)
                .mode = 0600, .group = STRDEF("test"), .user = STRDEF("test")});
 
         manifest->data.backupOptionOnline = BOOL_TRUE_VAR;
-        manifestFileAdd(
-            manifestPrior,
-            &(ManifestFile){
-               .name = STRDEF(MANIFEST_TARGET_PGDATA "/FILE2"), .size = 4, .sizeRepo = 4, .timestamp = 1482182860,
-               .checksumSha1 = "ddddddddddbbbbbbbbbbccccccccccaaaaaaaaaa"});
 
         TEST_RESULT_VOID(
             manifestBuildIncr(manifest, manifestPrior, backupTypeIncr, STRDEF("000000030000000300000003")), "incremental manifest");
@@ -1728,10 +1729,11 @@ testRun(void)
             "pg_data/PG_VERSION={\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\",\"master\":true"                        \
                 ",\"reference\":\"20190818-084502F_20190819-084506D\",\"size\":4,\"timestamp\":1565282114}\n"                      \
             "pg_data/base/16384/17000={\"checksum\":\"e0101dd8ffb910c9c202ca35b5f828bcb9697bed\",\"checksum-page\":false"          \
-                ",\"checksum-page-error\":[1],\"repo-size\":4096,\"size\":8192,\"timestamp\":1565282114}\n"                        \
-            "pg_data/base/16384/PG_VERSION={\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\",\"group\":false,\"size\":4"  \
-                ",\"timestamp\":1565282115}\n"                                                                                     \
-            "pg_data/base/32768/33000={\"checksum\":\"7a16d165e4775f7c92e8cdf60c0af57313f0bf90\",\"checksum-page\":true"           \
+                ",\"checksum-page-error\":[1],\"compress-level\":6,\"repo-size\":4096,\"size\":8192,\"timestamp\":1565282114}\n"   \
+            "pg_data/base/16384/PG_VERSION={\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\",\"compress\":false"          \
+                ",\"group\":false,\"size\":4,\"timestamp\":1565282115}\n"                                                          \
+            "pg_data/base/32768/33000={\"checksum\":\"7a16d165e4775f7c92e8cdf60c0af57313f0bf90\",\"checksum-block\":131072"        \
+                ",\"checksum-block-sha1\":\"5ea1a5b4da1ab7b9b2bd5a7e6ebf6c3a8b3b0a11\",\"checksum-page\":true"                     \
                 ",\"reference\":\"20190818-084502F\",\"size\":1073741824,\"timestamp\":1565282116}\n"                              \
             "pg_data/base/32768/33000.32767={\"checksum\":\"6e99b589e550e68e934fd235ccba59fe5b592a9e\",\"checksum-page\":true"     \
                 ",\"reference\":\"20190818-084502F\",\"size\":32768,\"timestamp\":1565282114}\n"                                   \
@@ -1828,12 +1830,52 @@ testRun(void)
 
         TEST_RESULT_VOID(manifestBackupLabelSet(manifest, STRDEF("20190818-084502F_20190820-084502D")), "backup label set");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("file range");
+
+        unsigned int fileIdxBegin = 0;
+        unsigned int fileIdxEnd = 0;
+
+        TEST_RESULT_VOID(manifestFileRange(manifest, STRDEF("pg_data/base"), &fileIdxBegin, &fileIdxEnd), "range of base");
+        TEST_RESULT_UINT(fileIdxBegin, 2, "    check begin");
+        TEST_RESULT_UINT(fileIdxEnd, 6, "    check end");
+
+        TEST_RESULT_VOID(manifestFileRange(manifest, STRDEF("pg_data/base/32768"), &fileIdxBegin, &fileIdxEnd), "range of db");
+        TEST_RESULT_STR_Z(manifestFile(manifest, fileIdxBegin)->name, "pg_data/base/32768/33000", "    check begin");
+        TEST_RESULT_UINT(fileIdxEnd, 6, "    check end");
+
+        TEST_RESULT_VOID(manifestFileRange(manifest, STRDEF("pg_data/base/3276"), &fileIdxBegin, &fileIdxEnd), "range of partial");
+        TEST_RESULT_UINT(fileIdxEnd - fileIdxBegin, 0, "    check empty");
+
+        TEST_RESULT_VOID(manifestFileRange(manifest, STRDEF("pg_tblspc"), &fileIdxBegin, &fileIdxEnd), "range of missing path");
+        TEST_RESULT_UINT(fileIdxBegin, manifestFileTotal(manifest), "    check begin");
+        TEST_RESULT_UINT(fileIdxEnd, manifestFileTotal(manifest), "    check end");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("summary load only stores files with page checksum errors");
+
+        Buffer *contentSummary = bufNew(0);
+        Manifest *manifestSummary = NULL;
+
+        TEST_RESULT_VOID(manifestSave(manifest, ioBufferWriteNew(contentSummary)), "save manifest");
+        TEST_ASSIGN(manifestSummary, manifestNewLoadSummary(ioBufferReadNew(contentSummary)), "load manifest summary");
+        TEST_RESULT_UINT(manifestFileTotal(manifestSummary), 1, "    check file total");
+        TEST_RESULT_STR_Z(manifestFile(manifestSummary, 0)->name, "pg_data/base/16384/17000", "    check file");
+        TEST_RESULT_STR_Z(manifestFile(manifestSummary, 0)->user, "user1", "    check file default");
+        TEST_RESULT_UINT(manifestDbTotal(manifestSummary), manifestDbTotal(manifest), "    check db total");
+        TEST_RESULT_UINT(manifestPathTotal(manifestSummary), manifestPathTotal(manifest), "    check path total");
+        TEST_RESULT_UINT(manifestTargetTotal(manifestSummary), manifestTargetTotal(manifest), "    check target total");
+        TEST_RESULT_STR_Z(manifestData(manifestSummary)->backupLabel, "20190818-084502F_20190820-084502D", "    check label");
+
+        TEST_RESULT_VOID(manifestFree(manifestSummary), "free manifest summary");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("manifest validation");
 
         // Munge files to produce errors
-        manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 0, NULL, NULL, false, false, NULL);
-        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 0, 0, NULL, NULL, true, false, NULL);
+        manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 0, 0, false, NULL, 0, NULL, NULL, false, false, NULL);
+        manifestFileUpdate(
+            manifest, STRDEF("pg_data/base/32768/33000.32767"), 0, 0, 0, false, NULL, 0, NULL, NULL, true, false, NULL);
 
         TEST_ERROR(
             manifestValidate(manifest, false), FormatError,
@@ -1848,10 +1890,11 @@ testRun(void)
             "repo size must be > 0 for file 'pg_data/postgresql.conf'");
 
         // Undo changes made to files
-        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, NULL, NULL, true, false, NULL);
         manifestFileUpdate(
-            manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "184473f470864e067ee3a22e64b47b0a1c356f29", NULL, false,
-            false, NULL);
+            manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, 0, false, NULL, 0, NULL, NULL, true, false, NULL);
+        manifestFileUpdate(
+            manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, 0, false, "184473f470864e067ee3a22e64b47b0a1c356f29", 0,
+            NULL, NULL, false, false, NULL);
 
         TEST_RESULT_VOID(manifestValidate(manifest, true), "successful validate");
 
@@ -1944,10 +1987,13 @@ testRun(void)
         TEST_RESULT_PTR(file, NULL, "    return default NULL");
 
         TEST_RESULT_VOID(
-            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "", NULL, false, false, NULL),
+            manifestFileUpdate(
+                manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, 0, false, "", 0, NULL, NULL, false, false, NULL),
             "update file");
         TEST_RESULT_VOID(
-            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, NULL, varNewStr(NULL), false, false, NULL),
+            manifestFileUpdate(
+                manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, 0, false, NULL, 0, NULL, varNewStr(NULL), false, false,
+                NULL),
             "update file");
 
         // ManifestDb getters
@@ -2134,6 +2180,11 @@ testRun(void)
         TEST_ASSIGN(manifest, manifestLoadFile(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), "load main");
         TEST_RESULT_UINT(manifestData(manifest)->pgSystemId, 1000000000000000094, "    check file loaded");
 
+        TEST_ASSIGN(
+            manifest, manifestLoadFileSummary(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), "load summary");
+        TEST_RESULT_UINT(manifestData(manifest)->pgSystemId, 1000000000000000094, "    check file loaded");
+        TEST_RESULT_UINT(manifestFileTotal(manifest), 0, "    check no files");
+
         TEST_RESULT_VOID(manifestFree(manifest), "free manifest");
         TEST_RESULT_VOID(manifestFree(NULL), "free null manifest");
     }
@@ -11,8 +11,10 @@ stress testing as needed.
 #include "common/harnessFork.h"
 #include "common/harnessStorage.h"
 
+#include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/compress/gz/compress.h"
+#include "common/compress/gz/decompress.h"
 #include "common/compress/lz4/compress.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/io/filter/sink.h"
@@ -256,6 +258,9 @@ testRun(void)
             ioFilterGroupAdd(ioWriteFilterGroup(write), filter);
 
         #define BENCHMARK_END(addTo)                                                                                               \
+            BENCHMARK_END_INPUT(addTo, input)
+
+        #define BENCHMARK_END_INPUT(addTo, input)                                                                                  \
             if (rateOut != 0)                                                                                                      \
                 ioFilterGroupAdd(ioWriteFilterGroup(write), testIoRateNew(rateOut * 1000 * 1000));                                 \
             ioFilterGroupAdd(ioWriteFilterGroup(write), ioSinkNew());                                                              \
@@ -288,12 +293,22 @@ testRun(void)
         uint64_t md5Total = 1;
         uint64_t sha1Total = 1;
         uint64_t sha256Total = 1;
+        uint64_t gzip1Total = 1;
         uint64_t gzip6Total = 1;
+        uint64_t gunzipTotal = 1;
 
 #ifdef HAVE_LIBLZ4
         uint64_t lz41Total = 1;
 #endif // HAVE_LIBLZ4
 
+        // Compress the input for the decompression benchmarks
+        Buffer *inputGz = bufNew(0);
+        IoWrite *writeGz = ioBufferWriteNew(inputGz);
+        ioFilterGroupAdd(ioWriteFilterGroup(writeGz), gzCompressNew(6));
+        ioWriteOpen(writeGz);
+        ioWrite(writeGz, input);
+        ioWriteClose(writeGz);
+
         for (unsigned int idx = 0; idx < iteration; idx++)
         {
             // -------------------------------------------------------------------------------------------------------------------------
@@ -339,6 +354,17 @@ testRun(void)
             }
             MEM_CONTEXT_TEMP_END();
 
+            // -------------------------------------------------------------------------------------------------------------------------
+            TEST_LOG_FMT("gzip -1 iteration %u", idx + 1);
+
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                BENCHMARK_BEGIN();
+                BENCHMARK_FILTER_ADD(gzCompressNew(1));
+                BENCHMARK_END(gzip1Total);
+            }
+            MEM_CONTEXT_TEMP_END();
+
             // -------------------------------------------------------------------------------------------------------------------------
             TEST_LOG_FMT("gzip -6 iteration %u", idx + 1);
 
@@ -350,6 +376,17 @@ testRun(void)
             }
             MEM_CONTEXT_TEMP_END();
 
+            // -------------------------------------------------------------------------------------------------------------------------
+            TEST_LOG_FMT("gunzip iteration %u", idx + 1);
+
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                BENCHMARK_BEGIN();
+                BENCHMARK_FILTER_ADD(gzDecompressNew());
+                BENCHMARK_END_INPUT(gunzipTotal, inputGz);
+            }
+            MEM_CONTEXT_TEMP_END();
+
             // -------------------------------------------------------------------------------------------------------------------------
 #ifdef HAVE_LIBLZ4
             TEST_LOG_FMT("lz4 -1 iteration %u", idx + 1);
@@ -376,12 +413,106 @@ testRun(void)
         TEST_RESULT("md5", md5Total);
         TEST_RESULT("sha1", sha1Total);
         TEST_RESULT("sha256", sha256Total);
+        TEST_RESULT("gzip -1", gzip1Total);
         TEST_RESULT("gzip -6", gzip6Total);
+        TEST_RESULT("gunzip", gunzipTotal);
 
 #ifdef HAVE_LIBLZ4
         TEST_RESULT("lz4 -1", lz41Total);
 #endif // HAVE_LIBLZ4
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("benchmark restore decode placement"))
+    {
+        // 4MB buffers are the current default
+        ioBufferSizeSet(4 * 1024 * 1024);
+
+        // 1MB is a fairly normal table size
+        CHECK(testScale() <= 1024 * 1024 * 1024);
+        uint64_t blockTotal = (uint64_t)1 * testScale();
+
+        // Set link rate between the repo host and the pg host
+        uint64_t rateLink = 100; // MB/s
+
+        // Get the sample pages from disk
+        Buffer *block = storageGetP(storageNewReadP(storagePosixNewP(STR(testRepoPath())), STRDEF("test/data/filecopy.table.bin")));
+        ASSERT(bufUsed(block) == 1024 * 1024);
+
+        // Build the input buffer
+        Buffer *input = bufNew((size_t)blockTotal * bufSize(block));
+
+        for (unsigned int blockIdx = 0; blockIdx < blockTotal; blockIdx++)
+            memcpy(bufPtr(input) + (blockIdx * bufSize(block)), bufPtr(block), bufSize(block));
+
+        bufUsedSet(input, bufSize(input));
+
+        // Compress and encrypt the input as it would be stored in the repo
+        Buffer *inputRepo = bufNew(0);
+        IoWrite *writeRepo = ioBufferWriteNew(inputRepo);
+        ioFilterGroupAdd(ioWriteFilterGroup(writeRepo), gzCompressNew(6));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(writeRepo), cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+        ioWriteOpen(writeRepo);
+        ioWrite(writeRepo, input);
+        ioWriteClose(writeRepo);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE_FMT(
+            "%zuKiB (%zuKiB in repo) with %" PRIu64 "MB/s link", bufUsed(input) / 1024, bufUsed(inputRepo) / 1024, rateLink);
+
+        // The link is simulated by a rate filter placed after the decode filters when decoding on the repo host and before them
+        // when decoding on the pg host
+        uint64_t decodeTotal[2] = {1, 1};
+
+        for (unsigned int decodeRepo = 0; decodeRepo <= 1; decodeRepo++)
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                IoWrite *write = ioBufferWriteNew(bufNew(0));
+
+                if (!decodeRepo)
+                    ioFilterGroupAdd(ioWriteFilterGroup(write), testIoRateNew(rateLink * 1000 * 1000));
+
+                ioFilterGroupAdd(
+                    ioWriteFilterGroup(write), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+                ioFilterGroupAdd(ioWriteFilterGroup(write), gzDecompressNew());
+
+                if (decodeRepo)
+                    ioFilterGroupAdd(ioWriteFilterGroup(write), testIoRateNew(rateLink * 1000 * 1000));
+
+                ioFilterGroupAdd(ioWriteFilterGroup(write), ioSinkNew());
+                ioWriteOpen(write);
+
+                IoRead *read = ioBufferReadNew(inputRepo);
+                ioReadOpen(read);
+
+                uint64_t benchMarkBegin = timeMSec();
+                Buffer *buffer = bufNew(ioBufferSize());
+
+                do
+                {
+                    ioRead(read, buffer);
+                    ioWrite(write, buffer);
+                    bufUsedZero(buffer);
+                }
+                while (!ioReadEof(read));
+
+                ioReadClose(read);
+                ioWriteClose(write);
+
+                decodeTotal[decodeRepo] += timeMSec() - benchMarkBegin;
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("results");
+
+        TEST_LOG_FMT("decode on pg host time %" PRIu64 "ms", decodeTotal[0]);
+        TEST_LOG_FMT("decode on repo host time %" PRIu64 "ms", decodeTotal[1]);
+        TEST_LOG_FMT("decode on %s host is faster at this link rate", decodeTotal[1] < decodeTotal[0] ? "repo" : "pg");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
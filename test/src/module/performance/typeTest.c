@@ -13,6 +13,7 @@ running out of memory on the test systems or taking an undue amount of time.  It
 #include "common/io/bufferWrite.h"
 #include "common/stat.h"
 #include "common/time.h"
+#include "common/type/json.h"
 #include "common/type/list.h"
 #include "common/type/object.h"
 #include "info/manifest.h"
@@ -43,13 +44,12 @@ testComparator(const void *item1, const void *item2)
 Test callback to count ini load results
 ***********************************************************************************************************************************/
 static void
-testIniLoadCountCallback(void *data, const String *section, const String *key, const String *value, const Variant *valueVar)
+testIniLoadCountCallback(void *data, const String *section, const String *key, const String *value)
 {
     (*(unsigned int *)data)++;
     (void)section;
     (void)key;
     (void)value;
-    (void)valueVar;
 }
 
 /***********************************************************************************************************************************
@@ -235,6 +235,72 @@ testRun(void)
         TEST_RESULT_INT(iniTotal, iniMax, "    check ini total");
     }
 
+    // Compare converting manifest-like file objects to a KeyValue with reading them with the pull-style reader
+    // *****************************************************************************************************************************
+    if (testBegin("jsonToVar()/JsonRead"))
+    {
+        CHECK(testScale() <= 10000);
+
+        const String *json = STRDEF(
+            "{\"checksum\":\"06d06bb31b570b94d7b4325f511f853dbe771c21\",\"checksum-page\":true,\"reference\":\"20190818-084502F\","
+            "\"repo-size\":4096,\"size\":8192,\"timestamp\":1565282114}");
+        unsigned int jsonMax = 100000 * (unsigned int)testScale();
+        uint64_t sizeTotal = 0;
+
+        TEST_LOG_FMT("objects = %u", jsonMax);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("jsonToVar()");
+
+        TimeMSec timeBegin = timeMSec();
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            for (unsigned int jsonIdx = 0; jsonIdx < jsonMax; jsonIdx++)
+            {
+                sizeTotal += varUInt64(kvGet(varKv(jsonToVar(json)), VARSTRDEF("size")));
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        TEST_LOG_FMT("completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+        TEST_RESULT_UINT(sizeTotal, (uint64_t)jsonMax * 8192, "    check size total");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("JsonRead");
+
+        timeBegin = timeMSec();
+        sizeTotal = 0;
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            for (unsigned int jsonIdx = 0; jsonIdx < jsonMax; jsonIdx++)
+            {
+                JsonRead *read = jsonReadNew(json);
+
+                jsonReadObjectBegin(read);
+
+                while (jsonReadTypeNext(read) != jsonTypeObjectEnd)
+                {
+                    if (jsonReadKeyMatchZ(read, "size"))
+                        sizeTotal += jsonReadUInt64(read);
+                    else
+                        jsonReadSkip(read);
+                }
+
+                jsonReadObjectEnd(read);
+                jsonReadFree(read);
+
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        TEST_LOG_FMT("completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+        TEST_RESULT_UINT(sizeTotal, (uint64_t)jsonMax * 8192, "    check size total");
+    }
+
     // Build/load/save a larger manifest to test performance and memory usage. The default sizing is for a "typical" large cluster
     // but this can be scaled to test larger cluster sizes.
     // *****************************************************************************************************************************
@@ -1,6 +1,7 @@
 /***********************************************************************************************************************************
 Test Posix Storage
 ***********************************************************************************************************************************/
+#include <fcntl.h>
 #include <unistd.h>
 #include <utime.h>
 
@@ -323,8 +324,7 @@ testRun(void)
 
         TEST_RESULT_VOID(
             storagePosixInfoListEntry(
-                (StoragePosix *)storageDriver(storageTest), strNew("pg"), strNew("missing"), storageInfoLevelBasic,
-                hrnStorageInfoListCallback, &callbackData),
+                AT_FDCWD, strNew("pg"), strNew("missing"), storageInfoLevelBasic, hrnStorageInfoListCallback, &callbackData),
             "missing path");
         TEST_RESULT_STR_Z(callbackData.content, "", "    check content");
 
@@ -740,6 +740,45 @@ testRun(void)
         TEST_RESULT_VOID(storagePathSyncP(storageTest, pathName), "sync path");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("storageFileSync()"))
+    {
+#ifdef TEST_CONTAINER_REQUIRED
+        TEST_CREATE_NOPERM();
+
+        TEST_ERROR_FMT(
+            storageFileSyncP(storageTest, fileNoPerm), FileOpenError, STORAGE_ERROR_FILE_SYNC_OPEN ": [13] Permission denied",
+            strZ(fileNoPerm));
+#endif // TEST_CONTAINER_REQUIRED
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        String *fileName = strNewFmt("%s/testfile", testPath());
+
+        TEST_ERROR_FMT(
+            storageFileSyncP(storageTest, fileName), FileMissingError, STORAGE_ERROR_FILE_SYNC_MISSING, strZ(fileName));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR_FMT(
+            storageFileSyncP(storagePosixNewP(strNew("/"), .write = true), strNew("/proc/self/stat")),
+            FileSyncError, STORAGE_ERROR_FILE_SYNC ": [22] Invalid argument", "/proc/self/stat");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(
+            storagePutP(storageNewWriteP(storageTest, fileName, .noSyncFile = true), BUFSTRDEF("TESTDATA")),
+            "write file without sync");
+        TEST_RESULT_VOID(storageFileSyncP(storageTest, fileName), "sync file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("storage without file sync does nothing");
+
+        Storage *storageNoSync = storagePosixNewP(strNew(testPath()), .write = true);
+        storageNoSync->interface.fileSync = NULL;
+
+        TEST_RESULT_VOID(storageFileSyncP(storageNoSync, strNew("missing")), "sync missing file");
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("storageNewRead()"))
     {
@@ -894,6 +933,21 @@ testRun(void)
 
         TEST_RESULT_VOID(storageRemoveP(storageTest, fileExists), "remove exists file");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("remove list of files");
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("list/file1")), NULL);
+        storagePutP(storageNewWriteP(storageTest, STRDEF("list/file2")), NULL);
+        storagePutP(storageNewWriteP(storageTest, STRDEF("list/file3")), NULL);
+
+        StringList *fileList = strLstNew();
+        strLstAddZ(fileList, "file1");
+        strLstAddZ(fileList, "missing");
+        strLstAddZ(fileList, "file3");
+
+        TEST_RESULT_VOID(storageRemoveListP(storageTest, STRDEF("list"), fileList), "remove list");
+        TEST_RESULT_STRLST_Z(storageListP(storageTest, STRDEF("list")), "file2\n", "    check remaining files");
+
         // -------------------------------------------------------------------------------------------------------------------------
 #ifdef TEST_CONTAINER_REQUIRED
         TEST_ERROR_FMT(
@@ -996,6 +1050,56 @@ testRun(void)
 
         TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "    close file");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read ahead hints that fail are ignored");
+
+        // The kernel rejects read ahead hints on a pipe with ESPIPE. The file must still be read, the same as on platforms where
+        // the hints are not defined and are compiled out.
+        String *pipeName = strNewFmt("%s/testpipe", testPath());
+        TEST_RESULT_INT(system(strZ(strNewFmt("mkfifo -m 666 %s", strZ(pipeName)))), 0, "create pipe");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                TEST_RESULT_INT(system(strZ(strNewFmt("printf PIPEDATA > %s", strZ(pipeName)))), 0, "write pipe");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_ASSIGN(file, storageNewReadP(storageTest, pipeName), "new read pipe");
+                TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open pipe");
+
+#ifdef POSIX_FADV_WILLNEED
+                TEST_RESULT_INT(
+                    posix_fadvise(((StorageReadPosix *)file->driver)->fd, 0, 0, POSIX_FADV_WILLNEED), ESPIPE,
+                    "    hint fails on pipe");
+#endif
+
+                bufUsedZero(buffer);
+
+                for (unsigned int readIdx = 0; readIdx < 4; readIdx++)
+                {
+                    TEST_RESULT_UINT(storageReadPosix(file->driver, outBuffer, true), 2, "    read block");
+                    bufCat(buffer, outBuffer);
+                    bufUsedZero(outBuffer);
+                }
+
+                TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->eof, false, "    not eof");
+                TEST_RESULT_UINT(storageReadPosix(file->driver, outBuffer, true), 0, "    read eof");
+                TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->eof, true, "    eof");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "PIPEDATA", "    check pipe contents");
+
+                TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "    close pipe");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        storageRemoveP(storageTest, pipeName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_VOID(storageReadFree(storageNewReadP(storageTest, fileName)), "   free file");
 
         TEST_RESULT_VOID(storageReadMove(NULL, memContextTop()), "   move null file");
@@ -1125,6 +1229,175 @@ testRun(void)
         TEST_RESULT_INT(storageInfoP(storageTest, fileName).mode, 0600, "    check file mode");
 
         storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write sparse file");
+
+        ioBufferSizeSet(16384);
+
+        // Data between zero blocks, a partial zero block, and data at the end of a buffer
+        Buffer *sparseBuffer = bufNew(16384 + 5000);
+        memset(bufPtr(sparseBuffer), 0, bufSize(sparseBuffer));
+        memset(bufPtr(sparseBuffer) + 4096, 'a', 4096);
+        memset(bufPtr(sparseBuffer) + 16384 + 4000, 'b', 100);
+        bufUsedSet(sparseBuffer, bufSize(sparseBuffer));
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .noSyncFile = true, .sparse = true), "new write file");
+        TEST_RESULT_VOID(storagePutP(file, sparseBuffer), "write file");
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "    check file contents");
+
+        // File that ends with a zero block
+        bufUsedSet(sparseBuffer, 16384);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .noSyncFile = true, .sparse = true), "new write file");
+        TEST_RESULT_VOID(storagePutP(file, sparseBuffer), "write file");
+        TEST_RESULT_UINT(storageInfoP(storageTest, fileName).size, 16384, "    check file size");
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "    check file contents");
+
+        // Errors when the file descriptor is invalid
+        fileTmp = strNewFmt("%s.pgbackrest.tmp", strZ(fileName));
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .noSyncFile = true, .sparse = true), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "    open file");
+
+        close(((StorageWritePosix *)file->driver)->fd);
+        storageRemoveP(storageTest, fileTmp, .errorOnMissing = true);
+
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, sparseBuffer), FileWriteError, "unable to write '%s': [9] Bad file descriptor",
+            strZ(fileTmp));
+        bufUsedSet(sparseBuffer, 16384 + 5000);
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, sparseBuffer), FileWriteError, "unable to write '%s': [9] Bad file descriptor",
+            strZ(fileTmp));
+        TEST_ERROR_FMT(
+            storageWritePosixClose(file->driver), FileWriteError, "unable to truncate '%s': [9] Bad file descriptor",
+            strZ(fileTmp));
+
+        // Disable sparse so close() can be reached
+        ((StorageWritePosix *)file->driver)->sparse = false;
+
+        TEST_ERROR_FMT(
+            storageWritePosixClose(file->driver), FileCloseError, STORAGE_ERROR_WRITE_CLOSE ": [9] Bad file descriptor",
+            strZ(fileTmp));
+
+        // Set file descriptor to -1 so the close on free with not fail
+        ((StorageWritePosix *)file->driver)->fd = -1;
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write behind");
+
+        // Write more than one buffer so writeback is started for each buffer as it is written
+        bufUsedSet(sparseBuffer, 16384 + 5000);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .writeBehind = true), "new write file");
+        TEST_RESULT_BOOL(((StorageWritePosix *)file->driver)->writeBehind, true, "    check write behind");
+        TEST_RESULT_VOID(storagePutP(file, sparseBuffer), "write file");
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "    check file contents");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName), "new write file");
+        TEST_RESULT_BOOL(((StorageWritePosix *)file->driver)->writeBehind, false, "    check no write behind by default");
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write behind hints that fail are ignored");
+
+        // The kernel rejects writeback and cache hints on a pipe with ESPIPE. The file must still be written, the same as on
+        // platforms where the hints are not defined and are compiled out.
+        String *pipeName = strNewFmt("%s/testpipe", testPath());
+        TEST_RESULT_INT(system(strZ(strNewFmt("mkfifo -m 666 %s", strZ(pipeName)))), 0, "create pipe");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                TEST_RESULT_INT(system(strZ(strNewFmt("cat %s > %s", strZ(pipeName), strZ(fileName)))), 0, "read pipe");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_ASSIGN(
+                    file,
+                    storageNewWriteP(
+                        storageTest, pipeName, .noCreatePath = true, .noSyncFile = true, .noSyncPath = true, .noAtomic = true,
+                        .writeBehind = true),
+                    "new write pipe");
+                TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "    open pipe");
+
+#ifdef POSIX_FADV_DONTNEED
+                TEST_RESULT_INT(
+                    posix_fadvise(((StorageWritePosix *)file->driver)->fd, 0, 0, POSIX_FADV_DONTNEED), ESPIPE,
+                    "    hint fails on pipe");
+#endif
+
+                TEST_RESULT_VOID(ioWrite(storageWriteIo(file), sparseBuffer), "    write pipe");
+                TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "    close pipe");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "    check pipe contents");
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write in place without truncating");
+
+        TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageTest, fileName), BUFSTRDEF("AAAABBBBCCCC")), "write file");
+
+        TEST_ASSIGN(
+            file, storageNewWriteP(storageTest, fileName, .noAtomic = true, .noTruncate = true, .offset = 4),
+            "new write at offset");
+        TEST_RESULT_VOID(storagePutP(file, BUFSTRDEF("bb")), "write in place");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, fileName))), "AAAAbbBBCCCC", "    check file contents");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .noAtomic = true, .noTruncate = true), "new write at start");
+        TEST_RESULT_VOID(storagePutP(file, BUFSTRDEF("aa")), "write in place");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, fileName))), "aaAAbbBBCCCC", "    check file contents");
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        TEST_ERROR_FMT(
+            storagePutP(storageNewWriteP(storageTest, fileName, .noAtomic = true, .noTruncate = true), BUFSTRDEF("aa")),
+            FileMissingError, STORAGE_ERROR_WRITE_MISSING, strZ(fileName));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write in place fails when the offset cannot be seeked to");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                TEST_RESULT_INT(system(strZ(strNewFmt("cat %s > /dev/null", strZ(pipeName)))), 0, "read pipe");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_ASSIGN(
+                    file,
+                    storageNewWriteP(
+                        storageTest, pipeName, .noCreatePath = true, .noSyncFile = true, .noSyncPath = true, .noAtomic = true,
+                        .noTruncate = true, .offset = 4),
+                    "new write pipe at offset");
+                TEST_ERROR_FMT(
+                    ioWriteOpen(storageWriteIo(file)), FileWriteError, "unable to seek to 4 in '%s': [29] Illegal seek",
+                    strZ(pipeName));
+
+                storageWriteFree(file);
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        storageRemoveP(storageTest, pipeName, .errorOnMissing = true);
     }
 
     // *****************************************************************************************************************************
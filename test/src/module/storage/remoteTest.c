@@ -421,9 +421,47 @@ testRun(void)
                     ",\"size\":8}}\n",
             "check result");
 
+        bufUsedSet(serverWrite, 0);
+
+        // Check protocol function directly (file ends with a partial block)
+        // -------------------------------------------------------------------------------------------------------------------------
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
+        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewVarLst(varLstNew()));
+
+        TEST_RESULT_BOOL(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, server), true,
+            "protocol open read (partial last block)");
+        TEST_RESULT_STR_Z(
+            strNewBuf(serverWrite),
+            "{\"out\":true}\n"
+                "BRBLOCK4\n"
+                "TESTBRBLOCK4\n"
+                "DATABRBLOCK1\n"
+                "!BRBLOCK0\n"
+                "{\"out\":{\"buffer\":null}}\n",
+            "check result");
+
         bufUsedSet(serverWrite, 0);
         ioBufferSizeSet(8192);
 
+        // Check protocol function directly (file smaller than one block)
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(
+            storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_OPEN_READ_STR, paramList, server), true,
+            "protocol open read (less than one block)");
+        TEST_RESULT_STR_Z(
+            strNewBuf(serverWrite),
+            "{\"out\":true}\n"
+                "BRBLOCK9\n"
+                "TESTDATA!BRBLOCK0\n"
+                "{\"out\":{\"buffer\":null}}\n",
+            "check result");
+
+        bufUsedSet(serverWrite, 0);
+
         // Check protocol function directly (file exists but all data goes to sink)
         // -------------------------------------------------------------------------------------------------------------------------
         storagePutP(storageNewWriteP(storageTest, strNew("repo/test.txt")), BUFSTRDEF("TESTDATA"));
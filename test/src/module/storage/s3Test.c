@@ -725,6 +725,285 @@ testRun(void)
                 TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt")), "new write");
                 TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("12345678901234567890")), "write");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with resume when there is no unfinished upload");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/?prefix=file.txt&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<IsTruncated>false</IsTruncated>"
+                        "</ListMultipartUploadsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>NW11</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=NW11", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:NW111");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=NW11", .content = "78");
+                testResponseP(service, .header = "etag:NW112");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=NW11",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>NW111</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>NW112</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt"), .resume = true), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("123456789012345678")), "write");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks resuming an unfinished upload");
+
+                // The first page of uploads has an older upload of the file that will be aborted and an upload of another file
+                testRequestP(service, s3, HTTP_VERB_GET, "/?prefix=file.txt&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<IsTruncated>true</IsTruncated>"
+                        "<NextKeyMarker>file.txt</NextKeyMarker>"
+                        "<NextUploadIdMarker>OLD1</NextUploadIdMarker>"
+                        "<Upload><Key>file.txt</Key><UploadId>OLD1</UploadId></Upload>"
+                        "<Upload><Key>file.txt.bak</Key><UploadId>BAK1</UploadId></Upload>"
+                        "</ListMultipartUploadsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/?key-marker=file.txt&prefix=file.txt&upload-id-marker=OLD1&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Upload><Key>file.txt</Key><UploadId>RSM1</UploadId></Upload>"
+                        "</ListMultipartUploadsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_DELETE, "/file.txt?uploadId=OLD1");
+                testResponseP(service, .code = 204);
+
+                // Part 1 has the same content so it is reused but part 2 differs so it is uploaded again
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt?uploadId=RSM1");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListPartsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<IsTruncated>true</IsTruncated>"
+                        "<NextPartNumberMarker>1</NextPartNumberMarker>"
+                        "<Part><PartNumber>1</PartNumber><ETag>\"abeac07d3c28c1bef9e730002c753ed4\"</ETag><Size>16</Size></Part>"
+                        "</ListPartsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt?part-number-marker=1&uploadId=RSM1");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListPartsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Part><PartNumber>2</PartNumber><ETag>\"def7924e3199be5e18060bb3e1d547a7\"</ETag><Size>4</Size></Part>"
+                        "</ListPartsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=RSM1", .content = "7890");
+                testResponseP(service, .header = "etag:RSM12");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=RSM1",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>\"abeac07d3c28c1bef9e730002c753ed4\"</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>RSM12</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt"), .resume = true), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("12345678901234567890")), "write");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with resume when unfinished uploads cannot be listed");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/?prefix=file.txt&uploads=");
+                testResponseP(service, .code = 403);
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>DN11</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=DN11", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:DN111");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=DN11", .content = "78");
+                testResponseP(service, .header = "etag:DN112");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=DN11",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>DN111</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>DN112</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt"), .resume = true), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("123456789012345678")), "write");
+                TEST_RESULT_LOG(
+                        "P00   WARN: access denied to unfinished S3 uploads so they will not be resumed or aborted\n"
+                        "            HINT: does the repository policy allow s3:ListBucketMultipartUploads,"
+                        " s3:ListMultipartUploadParts, and s3:AbortMultipartUpload?");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with resume skips unfinished uploads after access was denied");
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>DN21</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=DN21", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:DN211");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=DN21", .content = "78");
+                testResponseP(service, .header = "etag:DN212");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=DN21",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>DN211</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>DN212</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt"), .resume = true), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("123456789012345678")), "write");
+
+                driver->uploadDenied = false;
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with resume when the parts of an unfinished upload cannot be listed");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/?prefix=file.txt&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Upload><Key>file.txt</Key><UploadId>RSM2</UploadId></Upload>"
+                        "</ListMultipartUploadsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt?uploadId=RSM2");
+                testResponseP(service, .code = 403);
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>DN31</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=DN31", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:DN311");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=DN31", .content = "78");
+                testResponseP(service, .header = "etag:DN312");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=DN31",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>DN311</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>DN312</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt"), .resume = true), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("123456789012345678")), "write");
+                TEST_RESULT_LOG(
+                        "P00   WARN: access denied to unfinished S3 uploads so they will not be resumed or aborted\n"
+                        "            HINT: does the repository policy allow s3:ListBucketMultipartUploads,"
+                        " s3:ListMultipartUploadParts, and s3:AbortMultipartUpload?");
+
+                driver->uploadDenied = false;
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with resume when the unfinished upload is gone");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/?prefix=file.txt&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Upload><Key>file.txt</Key><UploadId>RSM3</UploadId></Upload>"
+                        "</ListMultipartUploadsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt?uploadId=RSM3");
+                testResponseP(service, .code = 404);
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>DN41</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=DN41", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:DN411");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=DN41", .content = "78");
+                testResponseP(service, .header = "etag:DN412");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=DN41",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>DN411</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>DN412</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt"), .resume = true), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("123456789012345678")), "write");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("file missing");
 
@@ -1058,6 +1337,14 @@ testRun(void)
                 testResponseP(
                     service, .content = "<DeleteResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"></DeleteResult>");
 
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "</ListMultipartUploadsResult>");
+
                 TEST_RESULT_VOID(storagePathRemoveP(s3, strNew("/"), .recurse = true), "remove");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -1071,6 +1358,14 @@ testRun(void)
                         "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
                         "</ListBucketResult>");
 
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?prefix=path%2F&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "</ListMultipartUploadsResult>");
+
                 TEST_RESULT_VOID(storagePathRemoveP(s3, strNew("/path"), .recurse = true), "remove");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -1124,7 +1419,73 @@ testRun(void)
                         "</Delete>\n");
                 testResponseP(service);
 
+                // Unfinished uploads in the path are aborted
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?prefix=path%2Fto%2F&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Upload><Key>path/to/test4.txt</Key><UploadId>ABT1</UploadId></Upload>"
+                        "</ListMultipartUploadsResult>");
+
+                testRequestP(service, s3, HTTP_VERB_DELETE, "/bucket/path/to/test4.txt?uploadId=ABT1");
+                testResponseP(service, .code = 204);
+
+                TEST_RESULT_VOID(storagePathRemoveP(s3, strNew("/path/to"), .recurse = true), "remove");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files when unfinished uploads cannot be aborted");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?list-type=2&prefix=path%2Fto%2F");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "</ListBucketResult>");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?prefix=path%2Fto%2F&uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListMultipartUploadsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Upload><Key>path/to/test4.txt</Key><UploadId>ABT2</UploadId></Upload>"
+                        "<Upload><Key>path/to/test5.txt</Key><UploadId>ABT3</UploadId></Upload>"
+                        "</ListMultipartUploadsResult>");
+
+                // Once access is denied the remaining uploads are not aborted
+                testRequestP(service, s3, HTTP_VERB_DELETE, "/bucket/path/to/test4.txt?uploadId=ABT2");
+                testResponseP(service, .code = 403);
+
                 TEST_RESULT_VOID(storagePathRemoveP(s3, strNew("/path/to"), .recurse = true), "remove");
+                TEST_RESULT_LOG(
+                        "P00   WARN: access denied to unfinished S3 uploads so they will not be resumed or aborted\n"
+                        "            HINT: does the repository policy allow s3:ListBucketMultipartUploads,"
+                        " s3:ListMultipartUploadParts, and s3:AbortMultipartUpload?");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files when unfinished uploads cannot be listed");
+
+                driver->uploadDenied = false;
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?list-type=2&prefix=path%2Fto%2F");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "</ListBucketResult>");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/?prefix=path%2Fto%2F&uploads=");
+                testResponseP(service, .code = 403);
+
+                TEST_RESULT_VOID(storagePathRemoveP(s3, strNew("/path/to"), .recurse = true), "remove");
+                TEST_RESULT_LOG(
+                        "P00   WARN: access denied to unfinished S3 uploads so they will not be resumed or aborted\n"
+                        "            HINT: does the repository policy allow s3:ListBucketMultipartUploads,"
+                        " s3:ListMultipartUploadParts, and s3:AbortMultipartUpload?");
 
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("remove error");
@@ -1171,6 +1532,52 @@ testRun(void)
 
                 TEST_RESULT_VOID(storageRemoveP(s3, strNew("/path/to/test.txt")), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove list of files");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/bucket/?delete=",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<Delete><Quiet>true</Quiet>"
+                        "<Object><Key>path/to/test1.txt</Key></Object>"
+                        "<Object><Key>path/to/test2.txt</Key></Object>"
+                        "</Delete>\n");
+                testResponseP(service);
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/bucket/?delete=",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<Delete><Quiet>true</Quiet>"
+                        "<Object><Key>path/to/test3.txt</Key></Object>"
+                        "</Delete>\n");
+                testResponseP(service);
+
+                StringList *fileList = strLstNew();
+                strLstAddZ(fileList, "test1.txt");
+                strLstAddZ(fileList, "test2.txt");
+                strLstAddZ(fileList, "test3.txt");
+
+                TEST_RESULT_VOID(storageRemoveListP(s3, strNew("/path/to"), fileList), "remove list");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove list of files from root");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/bucket/?delete=",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<Delete><Quiet>true</Quiet>"
+                        "<Object><Key>test1.txt</Key></Object>"
+                        "</Delete>\n");
+                testResponseP(service);
+
+                fileList = strLstNew();
+                strLstAddZ(fileList, "test1.txt");
+
+                TEST_RESULT_VOID(storageRemoveListP(s3, strNew("/"), fileList), "remove list");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 hrnServerScriptEnd(service);
             }